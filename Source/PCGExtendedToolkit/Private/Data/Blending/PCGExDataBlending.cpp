@@ -36,6 +36,11 @@ namespace PCGExDataBlending
 	{
 	}
 
+	void FDataBlendingOperationBase::DoRangeIntoOperation(const int32 WriteIndex, const int32 StartIndex, const int32 Count, const TArrayView<double>& Alphas) const
+	{
+		for (int i = 0; i < Count; i++) { DoOperation(WriteIndex, StartIndex + i, WriteIndex, Alphas[i]); }
+	}
+
 	void FDataBlendingOperationBase::ResetToDefault(const int32 WriteIndex) const
 	{
 		ResetRangeToDefault(WriteIndex, 1);
@@ -3,6 +3,7 @@
 
 #include "Data/Blending/PCGExMetadataBlender.h"
 
+#include "Async/ParallelFor.h"
 #include "Data/PCGExAttributeHelpers.h"
 #include "Data/Blending/PCGExDataBlending.h"
 
@@ -132,6 +133,31 @@ namespace PCGExDataBlending
 		}
 	}
 
+	void FMetadataBlender::BlendRangeInto(
+		const PCGEx::FPointRef& Target,
+		const int32 StartIndex,
+		const int32 Count,
+		const TArrayView<double>& Alphas,
+		const bool bParallel) const
+	{
+		const int32 NumAttributes = Attributes.Num();
+
+		// Attributes are independent from each other, the last job takes care of point properties.
+		ParallelFor(
+			NumAttributes + 1, [&](const int32 JobIndex)
+			{
+				if (JobIndex < NumAttributes)
+				{
+					Attributes[JobIndex]->DoRangeIntoOperation(Target.Index, StartIndex, Count, Alphas);
+					return;
+				}
+
+				if (!bBlendProperties) { return; }
+				FPCGPoint& TargetPoint = Target.MutablePoint();
+				for (int i = 0; i < Count; i++) { PropertiesBlender->Blend(TargetPoint, (*SecondaryPoints)[StartIndex + i], TargetPoint, Alphas[i]); }
+			}, !bParallel);
+	}
+
 	void FMetadataBlender::Write(const bool bFlush)
 	{
 		for (FDataBlendingOperationBase* Op : Attributes) { Op->Write(); }
@@ -5,6 +5,74 @@
 
 namespace PCGExDataBlending
 {
+#define PCGEX_PROPERTY_ACCESSOR(_TYPE, _NAME, _GET, _SET, _ZERO)\
+	struct F##_NAME##Property\
+	{\
+		static _TYPE Get(const FPCGPoint& Point) { return Point._GET; }\
+		static void Set(FPCGPoint& Point, const _TYPE& Value) { Point._SET(Value); }\
+		static _TYPE Zero() { return _ZERO; }\
+	};
+
+	PCGEX_PROPERTY_ACCESSOR(float, Density, Density, Density =, 0)
+	PCGEX_PROPERTY_ACCESSOR(FVector, BoundsMin, BoundsMin, BoundsMin =, FVector::ZeroVector)
+	PCGEX_PROPERTY_ACCESSOR(FVector, BoundsMax, BoundsMax, BoundsMax =, FVector::ZeroVector)
+	PCGEX_PROPERTY_ACCESSOR(FVector4, Color, Color, Color =, FVector4::Zero())
+	PCGEX_PROPERTY_ACCESSOR(FVector, Position, Transform.GetLocation(), Transform.SetLocation, FVector::ZeroVector)
+	PCGEX_PROPERTY_ACCESSOR(FQuat, Rotation, Transform.GetRotation(), Transform.SetRotation, FQuat(ForceInitToZero))
+	PCGEX_PROPERTY_ACCESSOR(FVector, Scale, Transform.GetScale3D(), Transform.SetScale3D, FVector::ZeroVector)
+	PCGEX_PROPERTY_ACCESSOR(float, Steepness, Steepness, Steepness =, 0)
+	PCGEX_PROPERTY_ACCESSOR(int32, Seed, Seed, Seed =, 0)
+
+#undef PCGEX_PROPERTY_ACCESSOR
+
+	template <typename TProperty>
+	static void PrepareAverage(FPCGPoint& Target) { TProperty::Set(Target, TProperty::Zero()); }
+
+	template <typename TProperty, EPCGExDataBlendingType BlendingType>
+	static void BlendProperty(const FPCGPoint& A, const FPCGPoint& B, FPCGPoint& Target, const double Alpha)
+	{
+		if constexpr (BlendingType == EPCGExDataBlendingType::Average) { TProperty::Set(Target, Add(TProperty::Get(A), TProperty::Get(B), Alpha)); }
+		else if constexpr (BlendingType == EPCGExDataBlendingType::Weight) { TProperty::Set(Target, Lerp(TProperty::Get(A), TProperty::Get(B), Alpha)); }
+		else if constexpr (BlendingType == EPCGExDataBlendingType::Min) { TProperty::Set(Target, Min(TProperty::Get(A), TProperty::Get(B), Alpha)); }
+		else if constexpr (BlendingType == EPCGExDataBlendingType::Max) { TProperty::Set(Target, Max(TProperty::Get(A), TProperty::Get(B), Alpha)); }
+		else if constexpr (BlendingType == EPCGExDataBlendingType::Copy) { TProperty::Set(Target, TProperty::Get(B)); }
+	}
+
+	template <typename TProperty>
+	static void CompleteAverage(FPCGPoint& Target, const double Alpha) { TProperty::Set(Target, Div(TProperty::Get(Target), Alpha)); }
+
+	template <typename TProperty>
+	static void CompileProperty(
+		const EPCGExDataBlendingType BlendingType,
+		TArray<FPropertyPrepareFunc, TInlineAllocator<9>>& PreparePlan,
+		TArray<FPropertyBlendFunc, TInlineAllocator<9>>& BlendPlan,
+		TArray<FPropertyCompleteFunc, TInlineAllocator<9>>& CompletePlan)
+	{
+		switch (BlendingType)
+		{
+		default:
+		case EPCGExDataBlendingType::None:
+			break;
+		case EPCGExDataBlendingType::Average:
+			PreparePlan.Add(&PrepareAverage<TProperty>);
+			BlendPlan.Add(&BlendProperty<TProperty, EPCGExDataBlendingType::Average>);
+			CompletePlan.Add(&CompleteAverage<TProperty>);
+			break;
+		case EPCGExDataBlendingType::Weight:
+			BlendPlan.Add(&BlendProperty<TProperty, EPCGExDataBlendingType::Weight>);
+			break;
+		case EPCGExDataBlendingType::Min:
+			BlendPlan.Add(&BlendProperty<TProperty, EPCGExDataBlendingType::Min>);
+			break;
+		case EPCGExDataBlendingType::Max:
+			BlendPlan.Add(&BlendProperty<TProperty, EPCGExDataBlendingType::Max>);
+			break;
+		case EPCGExDataBlendingType::Copy:
+			BlendPlan.Add(&BlendProperty<TProperty, EPCGExDataBlendingType::Copy>);
+			break;
+		}
+	}
+
 	FPropertiesBlender::FPropertiesBlender(const FPCGExBlendingSettings& Settings)
 	{
 		Init(Settings);
@@ -27,58 +95,35 @@ if(_NAME##Blending == EPCGExDataBlendingType::Average){bAverage##_NAME=true; bRe
 
 		PCGEX_FOREACH_BLEND_POINTPROPERTY(PCGEX_BLEND_FUNCASSIGN)
 #undef PCGEX_BLEND_FUNCASSIGN
+
+		CompilePlan();
+	}
+
+	void FPropertiesBlender::CompilePlan()
+	{
+		PreparePlan.Reset();
+		BlendPlan.Reset();
+		CompletePlan.Reset();
+
+#define PCGEX_BLEND_COMPILE(_TYPE, _NAME, ...) CompileProperty<F##_NAME##Property>(_NAME##Blending, PreparePlan, BlendPlan, CompletePlan);
+		PCGEX_FOREACH_BLEND_POINTPROPERTY(PCGEX_BLEND_COMPILE)
+#undef PCGEX_BLEND_COMPILE
 	}
 
 	void FPropertiesBlender::PrepareBlending(FPCGPoint& Target, const FPCGPoint& Default) const
 	{
-		Target.Density = bAverageDensity ? 0 : Default.Density;
-		Target.BoundsMin = bAverageBoundsMin ? FVector::ZeroVector : Default.BoundsMin;
-		Target.BoundsMax = bAverageBoundsMax ? FVector::ZeroVector : Default.BoundsMax;
-		Target.Color = bAverageColor ? FVector4::Zero() : Default.Color;
-		Target.Transform.SetLocation(bAveragePosition ? FVector::ZeroVector : Default.Transform.GetLocation());
-		Target.Transform.SetRotation(bAverageRotation ? FQuat{} : Default.Transform.GetRotation());
-		Target.Transform.SetScale3D(bAverageScale ? FVector::ZeroVector : Default.Transform.GetScale3D());
-		Target.Steepness = bAverageSteepness ? 0 : Default.Steepness;
-		Target.Seed = bAverageSeed ? 0 : Default.Seed;
+		// Non-averaged properties are overwritten by Blend anyway, only averaged ones need to start from zero.
+		for (const FPropertyPrepareFunc Prepare : PreparePlan) { Prepare(Target); }
 	}
 
-	void FPropertiesBlender::Blend(const FPCGPoint& A, const FPCGPoint& B, FPCGPoint& Target, double Alpha) const
+	void FPropertiesBlender::Blend(const FPCGPoint& A, const FPCGPoint& B, FPCGPoint& Target, const double Alpha) const
 	{
-#define PCGEX_BLEND_PROPDECL(_TYPE, _NAME, _FUNC, _ACCESSOR)\
-_TYPE Target##_NAME = Target._ACCESSOR;\
-switch (_NAME##Blending) {\
-case EPCGExDataBlendingType::None:		Target##_NAME = PCGExDataBlending::NoBlend(A._ACCESSOR, B._ACCESSOR, Alpha); break;\
-case EPCGExDataBlendingType::Average:	Target##_NAME = PCGExDataBlending::Add(A._ACCESSOR, B._ACCESSOR, Alpha);break;\
-case EPCGExDataBlendingType::Weight:	Target##_NAME = PCGExDataBlending::Lerp(A._ACCESSOR, B._ACCESSOR, Alpha);break;\
-case EPCGExDataBlendingType::Min:		Target##_NAME = PCGExDataBlending::Min(A._ACCESSOR, B._ACCESSOR, Alpha);break;\
-case EPCGExDataBlendingType::Max:		Target##_NAME = PCGExDataBlending::Max(A._ACCESSOR, B._ACCESSOR, Alpha);break;\
-case EPCGExDataBlendingType::Copy:		Target##_NAME = PCGExDataBlending::Copy(A._ACCESSOR, B._ACCESSOR, Alpha);break;}
-
-		PCGEX_FOREACH_BLENDINIT_POINTPROPERTY(PCGEX_BLEND_PROPDECL)
-#undef PCGEX_BLEND_PROPDECL
-
-		Target.Density = TargetDensity;
-		Target.BoundsMin = TargetBoundsMin;
-		Target.BoundsMax = TargetBoundsMax;
-		Target.Color = TargetColor;
-		Target.Transform.SetLocation(TargetPosition);
-		Target.Transform.SetRotation(TargetRotation);
-		Target.Transform.SetScale3D(TargetScale);
-		Target.Steepness = TargetSteepness;
-		Target.Seed = TargetSeed;
+		for (const FPropertyBlendFunc BlendFunc : BlendPlan) { BlendFunc(A, B, Target, Alpha); }
 	}
 
 	void FPropertiesBlender::CompleteBlending(FPCGPoint& Target, const double Alpha) const
 	{
-		if (bAverageDensity) { Target.Density = Div(Target.Density, Alpha); }
-		if (bAverageBoundsMin) { Target.BoundsMin = Div(Target.BoundsMin, Alpha); }
-		if (bAverageBoundsMax) { Target.BoundsMax = Div(Target.BoundsMax, Alpha); }
-		if (bAverageColor) { Target.Color = Div(Target.Color, Alpha); }
-		if (bAveragePosition) { Target.Transform.SetLocation(Div(Target.Transform.GetLocation(), Alpha)); }
-		if (bAverageRotation) { Target.Transform.SetRotation(Div(Target.Transform.GetRotation(), Alpha)); }
-		if (bAverageScale) { Target.Transform.SetScale3D(Div(Target.Transform.GetScale3D(), Alpha)); }
-		if (bAverageSteepness) { Target.Steepness = Div(Target.Steepness, Alpha); }
-		if (bAverageSeed) { Target.Seed = Div(Target.Seed, Alpha); }
+		for (const FPropertyCompleteFunc Complete : CompletePlan) { Complete(Target, Alpha); }
 	}
 
 	void FPropertiesBlender::BlendOnce(const FPCGPoint& A, const FPCGPoint& B, FPCGPoint& Target, const double Alpha) const
@@ -97,23 +142,24 @@ case EPCGExDataBlendingType::Copy:		Target##_NAME = PCGExDataBlending::Copy(A._A
 
 	void FPropertiesBlender::PrepareRangeBlending(const TArrayView<FPCGPoint>& Targets, const FPCGPoint& Default) const
 	{
-		for (FPCGPoint& Target : Targets) { PrepareBlending(Target, Default); }
+		for (const FPropertyPrepareFunc Prepare : PreparePlan) { for (FPCGPoint& Target : Targets) { Prepare(Target); } }
 	}
 
 	void FPropertiesBlender::BlendRange(const FPCGPoint& From, const FPCGPoint& To, const TArrayView<FPCGPoint>& Targets, const TArrayView<double>& Alphas) const
 	{
-		for (int i = 0; i < Targets.Num(); i++) { Blend(From, To, Targets[i], Alphas[i]); }
+		for (const FPropertyBlendFunc BlendFunc : BlendPlan) { for (int i = 0; i < Targets.Num(); i++) { BlendFunc(From, To, Targets[i], Alphas[i]); } }
 	}
 
 	void FPropertiesBlender::CompleteRangeBlending(const TArrayView<FPCGPoint>& Targets, const double Alpha) const
 	{
-		for (FPCGPoint& Target : Targets) { CompleteBlending(Target, Alpha); }
+		for (const FPropertyCompleteFunc Complete : CompletePlan) { for (FPCGPoint& Target : Targets) { Complete(Target, Alpha); } }
 	}
 
 	void FPropertiesBlender::BlendRangeOnce(const FPCGPoint& A, const FPCGPoint& B, const TArrayView<FPCGPoint>& Targets, const TArrayView<double>& Alphas) const
 	{
 		if (bRequiresPrepare)
 		{
+			// Targets may start with A itself, keep blending each target to completion before moving on to the next.
 			for (int i = 0; i < Targets.Num(); i++)
 			{
 				FPCGPoint& Target = Targets[i];
@@ -0,0 +1,27 @@
+﻿// Copyright Timothé Lapetite 2023
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Data/PCGExClusterData.h"
+
+UPCGExClusterEdgesData::UPCGExClusterEdgesData(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+}
+
+void UPCGExClusterEdgesData::SetTopology(const TSharedPtr<const PCGExMesh::FClusterTopology>& InTopology)
+{
+	FWriteScopeLock WriteLock(TopologyLock);
+	Topology = InTopology;
+}
+
+TSharedPtr<const PCGExMesh::FClusterTopology> UPCGExClusterEdgesData::GetTopology() const
+{
+	FReadScopeLock ReadLock(TopologyLock);
+	return Topology;
+}
+
+void UPCGExClusterEdgesData::BeginDestroy()
+{
+	Topology.Reset();
+	Super::BeginDestroy();
+}
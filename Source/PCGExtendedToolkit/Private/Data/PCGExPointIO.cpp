@@ -4,10 +4,69 @@
 #include "Data/PCGExPointIO.h"
 
 #include "PCGExMT.h"
+#include "Async/ParallelFor.h"
 #include "Metadata/Accessors/PCGAttributeAccessorKeys.h"
 
 namespace PCGExData
 {
+	void FPointsCache::Require(const TArray<FPCGPoint>& Points, const EPointsCache Components, const bool bParallel)
+	{
+		{
+			FReadScopeLock ReadLock(CacheLock);
+			if (EnumHasAllFlags(Built, Components)) { return; }
+		}
+
+		FWriteScopeLock WriteLock(CacheLock);
+		const EPointsCache Missing = Components & ~Built;
+		if (Missing == EPointsCache::None) { return; }
+
+		const int32 NumPoints = Points.Num();
+		const bool bPositions = EnumHasAnyFlags(Missing, EPointsCache::Positions);
+		const bool bRotations = EnumHasAnyFlags(Missing, EPointsCache::Rotations);
+		const bool bScales = EnumHasAnyFlags(Missing, EPointsCache::Scales);
+		const bool bExtents = EnumHasAnyFlags(Missing, EPointsCache::Extents);
+
+		if (bPositions)
+		{
+			X.SetNumUninitialized(NumPoints);
+			Y.SetNumUninitialized(NumPoints);
+			Z.SetNumUninitialized(NumPoints);
+		}
+		if (bRotations) { Rotations.SetNumUninitialized(NumPoints); }
+		if (bScales) { Scales.SetNumUninitialized(NumPoints); }
+		if (bExtents) { Extents.SetNumUninitialized(NumPoints); }
+
+		ParallelFor(
+			NumPoints, [&](const int32 Index)
+			{
+				const FPCGPoint& Point = Points[Index];
+				if (bPositions)
+				{
+					const FVector Location = Point.Transform.GetLocation();
+					X[Index] = Location.X;
+					Y[Index] = Location.Y;
+					Z[Index] = Location.Z;
+				}
+				if (bRotations) { Rotations[Index] = Point.Transform.GetRotation(); }
+				if (bScales) { Scales[Index] = Point.Transform.GetScale3D(); }
+				if (bExtents) { Extents[Index] = Point.GetExtents(); }
+			}, !bParallel);
+
+		Built |= Missing;
+	}
+
+	void FPointsCache::Invalidate()
+	{
+		FWriteScopeLock WriteLock(CacheLock);
+		Built = EPointsCache::None;
+		X.Empty();
+		Y.Empty();
+		Z.Empty();
+		Rotations.Empty();
+		Scales.Empty();
+		Extents.Empty();
+	}
+
 	void FPointIO::InitializeOutput(const EInit InitOut)
 	{
 		switch (InitOut)
@@ -27,6 +86,12 @@ namespace PCGExData
 			check(In)
 			Out = const_cast<UPCGPointData*>(In);
 			break;
+		case EInit::CopyOnWrite:
+			check(In)
+			Out = NewObject<UPCGPointData>();
+			Out->InitializeFromData(In);
+			Out->GetMutablePoints() = In->GetPoints();
+			break;
 		default: ;
 		}
 	}
@@ -58,6 +123,25 @@ namespace PCGExData
 
 	FPCGAttributeAccessorKeysPoints* FPointIO::GetOutKeys() const { return OutKeys; }
 
+	FAttributeCache* FPointIO::GetAttributeCache()
+	{
+		if (!In || Out == In) { return nullptr; }
+		return RootIO ? RootIO->GetAttributeCache() : &AttributeCache;
+	}
+
+	const FPointsCache& FPointIO::GetInPointsCache(const EPointsCache Components)
+	{
+		if (RootIO) { return RootIO->GetInPointsCache(Components); }
+		PointsCache.Require(In->GetPoints(), Components);
+		return PointsCache;
+	}
+
+	void FPointIO::InvalidatePointsCache() const
+	{
+		if (RootIO) { RootIO->InvalidatePointsCache(); }
+		else { PointsCache.Invalidate(); }
+	}
+
 
 	void FPointIO::InitPoint(FPCGPoint& Point, const PCGMetadataEntryKey FromKey) const
 	{
@@ -77,6 +161,7 @@ namespace PCGExData
 	FPCGPoint& FPointIO::CopyPoint(const FPCGPoint& FromPoint, int32& OutIndex) const
 	{
 		FWriteScopeLock WriteLock(PointsLock);
+		if (Out == In) { InvalidatePointsCache(); }
 		TArray<FPCGPoint>& MutablePoints = Out->GetMutablePoints();
 		FPCGPoint& Pt = MutablePoints.Add_GetRef(FromPoint);
 		OutIndex = MutablePoints.Num() - 1;
@@ -87,6 +172,7 @@ namespace PCGExData
 	FPCGPoint& FPointIO::NewPoint(int32& OutIndex) const
 	{
 		FWriteScopeLock WriteLock(PointsLock);
+		if (Out == In) { InvalidatePointsCache(); }
 		TArray<FPCGPoint>& MutablePoints = Out->GetMutablePoints();
 		FPCGPoint& Pt = MutablePoints.Emplace_GetRef();
 		OutIndex = MutablePoints.Num() - 1;
@@ -97,6 +183,7 @@ namespace PCGExData
 	void FPointIO::AddPoint(FPCGPoint& Point, int32& OutIndex, const bool bInit = true) const
 	{
 		FWriteScopeLock WriteLock(PointsLock);
+		if (Out == In) { InvalidatePointsCache(); }
 		TArray<FPCGPoint>& MutablePoints = Out->GetMutablePoints();
 		MutablePoints.Add(Point);
 		OutIndex = MutablePoints.Num() - 1;
@@ -106,12 +193,32 @@ namespace PCGExData
 	void FPointIO::AddPoint(FPCGPoint& Point, int32& OutIndex, const FPCGPoint& FromPoint) const
 	{
 		FWriteScopeLock WriteLock(PointsLock);
+		if (Out == In) { InvalidatePointsCache(); }
 		TArray<FPCGPoint>& MutablePoints = Out->GetMutablePoints();
 		MutablePoints.Add(Point);
 		OutIndex = MutablePoints.Num() - 1;
 		InitPoint(Point, FromPoint);
 	}
 
+	int32 FPointIO::AddPoints(const int32 Count) const
+	{
+		FWriteScopeLock WriteLock(PointsLock);
+		if (Out == In) { InvalidatePointsCache(); }
+		return Out->GetMutablePoints().AddDefaulted(Count);
+	}
+
+	void FPointIO::InitPoints(const int32 StartIndex, const int32 Count, const bool bParallel) const
+	{
+		TArray<FPCGPoint>& MutablePoints = Out->GetMutablePoints();
+		ParallelFor(
+			Count, [&](const int32 Index)
+			{
+				FPCGPoint& Point = MutablePoints[StartIndex + Index];
+				if (!In || Point.MetadataEntry == PCGInvalidEntryKey) { InitPoint(Point); }
+				else { InitPoint(Point, Point.MetadataEntry); }
+			}, !bParallel);
+	}
+
 	UPCGPointData* FPointIO::NewEmptyOutput() const
 	{
 		return PCGExPointIO::NewEmptyPointData(In);
@@ -129,6 +236,9 @@ namespace PCGExData
 		else { InKeys = nullptr; }
 
 		PCGEX_DELETE(OutKeys)
+
+		AttributeCache.Flush();
+		PointsCache.Invalidate();
 	}
 
 	FPointIO::~FPointIO()
@@ -3,6 +3,96 @@
 
 #include "Data/PCGExPointIOMerger.h"
 
+#include "Async/ParallelFor.h"
+
+namespace PCGExPointIOMerger
+{
+	static int32 GetNumericRank(const EPCGMetadataTypes Type)
+	{
+		switch (Type)
+		{
+		case EPCGMetadataTypes::Boolean: return 0;
+		case EPCGMetadataTypes::Integer32: return 1;
+		case EPCGMetadataTypes::Integer64: return 2;
+		case EPCGMetadataTypes::Float: return 3;
+		case EPCGMetadataTypes::Double: return 4;
+		case EPCGMetadataTypes::Vector2: return 5;
+		case EPCGMetadataTypes::Vector: return 6;
+		case EPCGMetadataTypes::Vector4: return 7;
+		default: return -1;
+		}
+	}
+
+	static bool IsRotation(const EPCGMetadataTypes Type)
+	{
+		return Type == EPCGMetadataTypes::Quaternion || Type == EPCGMetadataTypes::Rotator || Type == EPCGMetadataTypes::Transform;
+	}
+
+	/**
+	 * Smallest type both A & B widen to.
+	 * - Numeric & vector types widen along bool < int32 < int64 < float < double < Vector2 < Vector < Vector4, int64 & float meet at double
+	 * - Rotator & Quaternion meet at Quaternion, both widen to Transform
+	 * - Name widens to String, and any other mix falls back to String
+	 */
+	static EPCGMetadataTypes GetWiderType(const EPCGMetadataTypes A, const EPCGMetadataTypes B)
+	{
+		if (A == B) { return A; }
+
+		const int32 RankA = GetNumericRank(A);
+		const int32 RankB = GetNumericRank(B);
+
+		if (RankA != -1 && RankB != -1)
+		{
+			if ((A == EPCGMetadataTypes::Integer64 && B == EPCGMetadataTypes::Float) ||
+				(A == EPCGMetadataTypes::Float && B == EPCGMetadataTypes::Integer64)) { return EPCGMetadataTypes::Double; }
+			return RankA > RankB ? A : B;
+		}
+
+		if (IsRotation(A) && IsRotation(B))
+		{
+			if (A == EPCGMetadataTypes::Transform || B == EPCGMetadataTypes::Transform) { return EPCGMetadataTypes::Transform; }
+			return EPCGMetadataTypes::Quaternion;
+		}
+
+		return EPCGMetadataTypes::String;
+	}
+
+	template <typename T>
+	static FString ToString(const T& Value)
+	{
+		if constexpr (std::is_same_v<T, FString>) { return Value; }
+		else if constexpr (std::is_same_v<T, bool>) { return Value ? TEXT("true") : TEXT("false"); }
+		else if constexpr (std::is_same_v<T, int32>) { return FString::FromInt(Value); }
+		else if constexpr (std::is_same_v<T, int64>) { return FString::Printf(TEXT("%lld"), Value); }
+		else if constexpr (std::is_arithmetic_v<T>) { return FString::SanitizeFloat(Value); }
+		else { return Value.ToString(); }
+	}
+
+	/**
+	 * Widening conversion matching GetWiderType
+	 */
+	template <typename From, typename To>
+	static To Convert(const From& Value)
+	{
+		if constexpr (std::is_same_v<From, To>) { return Value; }
+		else if constexpr (std::is_same_v<To, FString>) { return ToString(Value); }
+		else if constexpr (std::is_arithmetic_v<From> && std::is_arithmetic_v<To>) { return static_cast<To>(Value); }
+		else if constexpr (std::is_arithmetic_v<From> && std::is_same_v<To, FVector2D>) { return FVector2D(static_cast<double>(Value)); }
+		else if constexpr (std::is_arithmetic_v<From> && std::is_same_v<To, FVector>) { return FVector(static_cast<double>(Value)); }
+		else if constexpr (std::is_arithmetic_v<From> && std::is_same_v<To, FVector4>)
+		{
+			const double D = static_cast<double>(Value);
+			return FVector4(D, D, D, D);
+		}
+		else if constexpr (std::is_same_v<From, FVector2D> && std::is_same_v<To, FVector>) { return FVector(Value.X, Value.Y, 0); }
+		else if constexpr (std::is_same_v<From, FVector2D> && std::is_same_v<To, FVector4>) { return FVector4(Value.X, Value.Y, 0, 0); }
+		else if constexpr (std::is_same_v<From, FVector> && std::is_same_v<To, FVector4>) { return FVector4(Value.X, Value.Y, Value.Z, 0); }
+		else if constexpr (std::is_same_v<From, FRotator> && std::is_same_v<To, FQuat>) { return Value.Quaternion(); }
+		else if constexpr ((std::is_same_v<From, FRotator> || std::is_same_v<From, FQuat>) && std::is_same_v<To, FTransform>) { return FTransform(Value); }
+		else { return To{}; }
+	}
+}
+
 FPCGExPointIOMerger::FPCGExPointIOMerger(PCGExData::FPointIO& OutData)
 {
 	MergedData = &OutData;
@@ -26,7 +116,11 @@ void FPCGExPointIOMerger::Append(PCGExData::FPointIO& InData)
 	PCGEx::FAttributeIdentity::Get(InData.GetIn(), NewIdentities);
 	for (PCGEx::FAttributeIdentity& NewIdentity : NewIdentities)
 	{
-		if (Identities.Find(NewIdentity.Name)) { continue; } //TODO: Will likely create issues if there is an attribute mismatch, resolve during merge.
+		if (PCGEx::FAttributeIdentity* Identity = Identities.Find(NewIdentity.Name))
+		{
+			Identity->UnderlyingType = PCGExPointIOMerger::GetWiderType(Identity->UnderlyingType, NewIdentity.UnderlyingType);
+			continue;
+		}
 		Identities.Add(NewIdentity.Name, NewIdentity);
 		AllowsInterpolation.Add(NewIdentity.Name, InData.GetIn()->Metadata->GetConstAttribute(NewIdentity.Name)->AllowsInterpolation());
 	}
@@ -42,25 +136,43 @@ void FPCGExPointIOMerger::Append(const TArray<PCGExData::FPointIO*>& InData)
 
 void FPCGExPointIOMerger::DoMerge()
 {
-	TArray<FPCGPoint>& MutablePoints = MergedData->GetOut()->GetMutablePoints();
-	MutablePoints.SetNum(TotalPoints);
+	const int32 NumSources = MergedPoints.Num();
 
-	MergedData->CreateOutKeys();
+	TArray<int32> StartIndices;
+	StartIndices.SetNumUninitialized(NumSources);
 
 	int32 StartIndex = 0;
-	for (const PCGExData::FPointIO* PointIO : MergedPoints)
+	for (int i = 0; i < NumSources; i++)
 	{
-		const TArray<FPCGPoint>& InPoints = PointIO->GetIn()->GetPoints();
-		for (int i = 0; i < InPoints.Num(); i++)
-		{
-			const int32 PtIndex = StartIndex + i;
-			const PCGMetadataEntryKey ExistingKey = MutablePoints[PtIndex].MetadataEntry;
-			MutablePoints[PtIndex] = InPoints[i];
-			MutablePoints[PtIndex].MetadataEntry = ExistingKey;
-		}
+		StartIndices[i] = StartIndex;
+		StartIndex += MergedPoints[i]->GetNum();
 	}
 
-	//TODO : Refactor this
+	TArray<FPCGPoint>& MutablePoints = MergedData->GetOut()->GetMutablePoints();
+	MutablePoints.SetNum(TotalPoints);
+
+	ParallelFor(
+		NumSources, [&](const int32 SourceIndex)
+		{
+			const TArray<FPCGPoint>& InPoints = MergedPoints[SourceIndex]->GetIn()->GetPoints();
+			const int32 Offset = StartIndices[SourceIndex];
+			for (int i = 0; i < InPoints.Num(); i++)
+			{
+				FPCGPoint& Point = MutablePoints[Offset + i];
+				Point = InPoints[i];
+				Point.MetadataEntry = PCGInvalidEntryKey;
+			}
+		});
+
+	MergedData->InitPoints(0, TotalPoints);
+	MergedData->CreateOutKeys();
+
+	// Writers are created upfront as creating attributes isn't thread-safe,
+	// then every (source, attribute) range is copied in parallel
+
+	TArray<TFunction<void(const int32)>> CopyRanges;
+	TArray<TFunction<void()>> WriteAttributes;
+
 	for (const TPair<FName, PCGEx::FAttributeIdentity>& Identity : Identities)
 	{
 		PCGMetadataAttribute::CallbackWithRightType(
@@ -68,32 +180,64 @@ void FPCGExPointIOMerger::DoMerge()
 			{
 				using T = decltype(DummyValue);
 				PCGEx::TFAttributeWriter<T>* Writer = new PCGEx::TFAttributeWriter<T>(Identity.Key, T{}, *AllowsInterpolation.Find(Identity.Key));
-				Writer->BindAndGet(*MergedData);
+				Writer->Bind(*MergedData);
+				Writer->SetNum(TotalPoints);
 
-				StartIndex = 0;
-				for (PCGExData::FPointIO* PointIO : MergedPoints)
-				{
-					const int32 NumPoints = PointIO->GetIn()->GetPoints().Num();
-
-					PCGEx::TFAttributeReader<T>* Reader = new PCGEx::TFAttributeReader<T>(Identity.Key);
-					if (Reader->Bind(*PointIO))
+				const FName AttributeName = Identity.Key;
+				CopyRanges.Add([this, Writer, AttributeName, &StartIndices](const int32 SourceIndex) { CopyAttributeRange<T>(Writer, AttributeName, SourceIndex, StartIndices[SourceIndex]); });
+				WriteAttributes.Add(
+					[Writer]()
 					{
-						for (int i = 0; i < NumPoints; i++)
-						{
-							const int32 PtIndex = StartIndex + i;
-							Writer->Values[PtIndex] = Reader->Values[i];
-						}
-					}
-
-					PCGEX_DELETE(Reader)
-					StartIndex += PointIO->GetNum();
-				}
-
-				Writer->Write();
-				PCGEX_DELETE(Writer)
+						Writer->Write();
+						delete Writer;
+					});
 			});
 	}
 
+	const int32 NumAttributes = CopyRanges.Num();
+	ParallelFor(NumSources * NumAttributes, [&](const int32 Index) { CopyRanges[Index % NumAttributes](Index / NumAttributes); });
+
+	for (const TFunction<void()>& Write : WriteAttributes) { Write(); }
+
 	for (PCGExData::FPointIO* PointIO : MergedPoints) { PointIO->Cleanup(); }
 	MergedData->Cleanup();
 }
+
+template <typename T>
+void FPCGExPointIOMerger::CopyAttributeRange(PCGEx::TFAttributeWriter<T>* Writer, const FName AttributeName, const int32 SourceIndex, const int32 StartIndex) const
+{
+	const PCGExData::FPointIO* PointIO = MergedPoints[SourceIndex];
+	const UPCGPointData* InData = PointIO->GetIn();
+	const int32 NumPoints = InData->GetPoints().Num();
+	TArrayView<T> OutValues = MakeArrayView(Writer->Values.GetData() + StartIndex, NumPoints);
+
+	const FPCGMetadataAttributeBase* Attribute = InData->Metadata->GetConstAttribute(AttributeName);
+	if (!Attribute)
+	{
+		const T DefaultValue = Writer->GetDefaultValue();
+		for (int i = 0; i < NumPoints; i++) { OutValues[i] = DefaultValue; }
+		return;
+	}
+
+	PCGMetadataAttribute::CallbackWithRightType(
+		Attribute->GetTypeId(), [&](auto DummyValue)
+		{
+			using RawT = decltype(DummyValue);
+
+			FPCGMetadataAttribute<RawT>* TypedAttribute = InData->Metadata->GetMutableTypedAttribute<RawT>(AttributeName);
+			const FPCGAttributeAccessor<RawT> Accessor(TypedAttribute, InData->Metadata);
+
+			if constexpr (std::is_same_v<RawT, T>)
+			{
+				Accessor.GetRange(OutValues, 0, *PointIO->GetInKeys(), PCGEX_AAFLAG);
+			}
+			else
+			{
+				TArray<RawT> RawValues;
+				RawValues.SetNum(NumPoints);
+				TArrayView<RawT> View(RawValues);
+				Accessor.GetRange(View, 0, *PointIO->GetInKeys(), PCGEX_AAFLAG);
+				for (int i = 0; i < NumPoints; i++) { OutValues[i] = PCGExPointIOMerger::Convert<RawT, T>(RawValues[i]); }
+			}
+		});
+}
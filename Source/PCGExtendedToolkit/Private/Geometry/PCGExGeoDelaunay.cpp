@@ -0,0 +1,778 @@
+﻿// Copyright Timothé Lapetite 2023
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Geometry/PCGExGeoDelaunay.h"
+
+#include "PCGExMT.h"
+#include "Async/ParallelFor.h"
+
+namespace PCGExGeo
+{
+#pragma region FDelaunay2
+
+	FDelaunay2::~FDelaunay2()
+	{
+		Edges.Empty();
+		Triangles.Empty();
+	}
+
+	bool FDelaunay2::Process(const TArray<FVector2D>& Positions)
+	{
+		Edges.Reset();
+		Triangles.Reset();
+
+		const int32 NumPositions = Positions.Num();
+
+		TArray<int32> Order;
+		Order.SetNumUninitialized(NumPositions);
+		for (int i = 0; i < NumPositions; i++) { Order[i] = i; }
+
+		Order.Sort(
+			[&](const int32 A, const int32 B)
+			{
+				const FVector2D& PA = Positions[A];
+				const FVector2D& PB = Positions[B];
+				return PA.X < PB.X || (PA.X == PB.X && PA.Y < PB.Y);
+			});
+
+		Sites.Reset(NumPositions);
+		SiteIndices.Reset(NumPositions);
+
+		for (const int32 Index : Order)
+		{
+			if (!Sites.IsEmpty() && Sites.Last() == Positions[Index]) { continue; }
+			Sites.Add(Positions[Index]);
+			SiteIndices.Add(Index);
+		}
+
+		Order.Empty();
+
+		const int32 NumSites = Sites.Num();
+		if (NumSites < 2)
+		{
+			Sites.Empty();
+			SiteIndices.Empty();
+			return false;
+		}
+
+		// A planar triangulation has at most 3n edges
+		const int32 NumReserve = NumSites * 3 * 4;
+		QuadNext.Reset(NumReserve);
+		QuadOrg.Reset(NumReserve);
+		QuadDeleted.Reset(NumReserve / 4);
+
+		int32 Left;
+		int32 Right;
+		Divide(0, NumSites, Left, Right);
+
+		Gather();
+
+		Sites.Empty();
+		SiteIndices.Empty();
+		QuadNext.Empty();
+		QuadOrg.Empty();
+		QuadDeleted.Empty();
+
+		return true;
+	}
+
+	int32 FDelaunay2::MakeEdge(const int32 InOrg, const int32 InDest)
+	{
+		const int32 E = QuadNext.Num();
+
+		QuadNext.Add(E);
+		QuadNext.Add(E + 3);
+		QuadNext.Add(E + 2);
+		QuadNext.Add(E + 1);
+
+		QuadOrg.Add(InOrg);
+		QuadOrg.Add(-1);
+		QuadOrg.Add(InDest);
+		QuadOrg.Add(-1);
+
+		QuadDeleted.Add(false);
+
+		return E;
+	}
+
+	void FDelaunay2::Splice(const int32 A, const int32 B)
+	{
+		const int32 Alpha = Rot(QuadNext[A]);
+		const int32 Beta = Rot(QuadNext[B]);
+
+		Swap(QuadNext[A], QuadNext[B]);
+		Swap(QuadNext[Alpha], QuadNext[Beta]);
+	}
+
+	int32 FDelaunay2::Connect(const int32 A, const int32 B)
+	{
+		const int32 E = MakeEdge(Dest(A), Org(B));
+		Splice(E, Lnext(A));
+		Splice(Sym(E), B);
+		return E;
+	}
+
+	void FDelaunay2::DeleteEdge(const int32 E)
+	{
+		Splice(E, Oprev(E));
+		Splice(Sym(E), Oprev(Sym(E)));
+		QuadDeleted[E / 4] = true;
+	}
+
+	bool FDelaunay2::CCW(const int32 A, const int32 B, const int32 C) const
+	{
+		const FVector2D& PA = Sites[A];
+		const FVector2D& PB = Sites[B];
+		const FVector2D& PC = Sites[C];
+		return (PB.X - PA.X) * (PC.Y - PA.Y) - (PB.Y - PA.Y) * (PC.X - PA.X) > 0;
+	}
+
+	bool FDelaunay2::InCircle(const int32 A, const int32 B, const int32 C, const int32 D) const
+	{
+		const FVector2D& PD = Sites[D];
+		const FVector2D AD = Sites[A] - PD;
+		const FVector2D BD = Sites[B] - PD;
+		const FVector2D CD = Sites[C] - PD;
+
+		return AD.SizeSquared() * (BD.X * CD.Y - CD.X * BD.Y) -
+			BD.SizeSquared() * (AD.X * CD.Y - CD.X * AD.Y) +
+			CD.SizeSquared() * (AD.X * BD.Y - BD.X * AD.Y) > 0;
+	}
+
+	void FDelaunay2::Divide(const int32 Lo, const int32 Hi, int32& OutLeft, int32& OutRight)
+	{
+		const int32 Num = Hi - Lo;
+
+		if (Num == 2)
+		{
+			const int32 A = MakeEdge(Lo, Lo + 1);
+			OutLeft = A;
+			OutRight = Sym(A);
+			return;
+		}
+
+		if (Num == 3)
+		{
+			const int32 A = MakeEdge(Lo, Lo + 1);
+			const int32 B = MakeEdge(Lo + 1, Lo + 2);
+			Splice(Sym(A), B);
+
+			if (CCW(Lo, Lo + 1, Lo + 2))
+			{
+				Connect(B, A);
+				OutLeft = A;
+				OutRight = Sym(B);
+			}
+			else if (CCW(Lo, Lo + 2, Lo + 1))
+			{
+				const int32 C = Connect(B, A);
+				OutLeft = Sym(C);
+				OutRight = C;
+			}
+			else
+			{
+				// Collinear
+				OutLeft = A;
+				OutRight = Sym(B);
+			}
+
+			return;
+		}
+
+		const int32 Mid = Lo + Num / 2;
+
+		int32 LDO, LDI, RDI, RDO;
+		Divide(Lo, Mid, LDO, LDI);
+		Divide(Mid, Hi, RDI, RDO);
+
+		// Find the lower common tangent of both halves
+		while (true)
+		{
+			if (LeftOf(Org(RDI), LDI)) { LDI = Lnext(LDI); }
+			else if (RightOf(Org(LDI), RDI)) { RDI = Rprev(RDI); }
+			else { break; }
+		}
+
+		int32 Basel = Connect(Sym(RDI), LDI);
+		if (Org(LDI) == Org(LDO)) { LDO = Sym(Basel); }
+		if (Org(RDI) == Org(RDO)) { RDO = Basel; }
+
+		// Zip both halves upward
+		while (true)
+		{
+			int32 LCand = Onext(Sym(Basel));
+			if (RightOf(Dest(LCand), Basel))
+			{
+				while (InCircle(Dest(Basel), Org(Basel), Dest(LCand), Dest(Onext(LCand))))
+				{
+					const int32 Next = Onext(LCand);
+					DeleteEdge(LCand);
+					LCand = Next;
+				}
+			}
+
+			int32 RCand = Oprev(Basel);
+			if (RightOf(Dest(RCand), Basel))
+			{
+				while (InCircle(Dest(Basel), Org(Basel), Dest(RCand), Dest(Oprev(RCand))))
+				{
+					const int32 Next = Oprev(RCand);
+					DeleteEdge(RCand);
+					RCand = Next;
+				}
+			}
+
+			const bool bValidL = RightOf(Dest(LCand), Basel);
+			const bool bValidR = RightOf(Dest(RCand), Basel);
+
+			if (!bValidL && !bValidR) { break; }
+
+			if (!bValidL || (bValidR && InCircle(Dest(LCand), Org(LCand), Org(RCand), Dest(RCand))))
+			{
+				Basel = Connect(RCand, Sym(Basel));
+			}
+			else
+			{
+				Basel = Connect(Sym(Basel), Sym(LCand));
+			}
+		}
+
+		OutLeft = LDO;
+		OutRight = RDO;
+	}
+
+	void FDelaunay2::Gather()
+	{
+		const int32 NumQuads = QuadDeleted.Num();
+
+		Edges.Reserve(NumQuads);
+		Triangles.Reserve(NumQuads);
+
+		TArray<bool> Visited;
+		Visited.Init(false, QuadNext.Num());
+
+		for (int q = 0; q < NumQuads; q++)
+		{
+			if (QuadDeleted[q]) { continue; }
+
+			const int32 E = q * 4;
+			Edges.Emplace(SiteIndices[Org(E)], SiteIndices[Dest(E)], EPCGExEdgeType::Complete);
+
+			for (const int32 Start : {E, E + 2})
+			{
+				if (Visited[Start]) { continue; }
+
+				const int32 E1 = Lnext(Start);
+				const int32 E2 = Lnext(E1);
+				if (Lnext(E2) != Start) { continue; }
+
+				Visited[Start] = Visited[E1] = Visited[E2] = true;
+
+				// Skip the outer face when the hull is a triangle
+				if (!CCW(Org(Start), Dest(Start), Dest(E1))) { continue; }
+				Triangles.Emplace(SiteIndices[Org(Start)], SiteIndices[Dest(Start)], SiteIndices[Dest(E1)]);
+			}
+		}
+	}
+
+#pragma endregion
+
+#pragma region FDelaunay3
+
+	// Face opposite each cell vertex, wound so that the opposite vertex lies on its positive side
+	static constexpr int32 FaceVertices[4][3] = {{1, 3, 2}, {0, 2, 3}, {0, 3, 1}, {0, 1, 2}};
+
+	FDelaunay3::~FDelaunay3()
+	{
+		Edges.Empty();
+		Tetrahedra.Empty();
+	}
+
+	double FDelaunay3::Orient(const FVector& A, const FVector& B, const FVector& C, const FVector& D)
+	{
+		return FVector::DotProduct(B - A, FVector::CrossProduct(C - A, D - A));
+	}
+
+	int32 FDelaunay3::AddCell(const int32 A, const int32 B, const int32 C, const int32 D)
+	{
+		if (!FreeCells.IsEmpty())
+		{
+			const int32 Cell = FreeCells.Pop(false);
+			Cells[Cell] = FIntVector4(A, B, C, D);
+			CellNeighbors[Cell] = FIntVector4(-1, -1, -1, -1);
+			CellDead[Cell] = false;
+			return Cell;
+		}
+
+		const int32 Cell = Cells.Emplace(A, B, C, D);
+		CellNeighbors.Emplace(-1, -1, -1, -1);
+		CellDead.Add(false);
+		CavityStamp.Add(0);
+		return Cell;
+	}
+
+	bool FDelaunay3::InSphere(const int32 Cell, const FVector& P) const
+	{
+		// Lifted determinant relative to P rather than a stored circumsphere,
+		// which loses too much precision on cells connected to the enclosing tetrahedron.
+		const FIntVector4& Vtx = Cells[Cell];
+		const FVector A = Sites[Vtx.X] - P;
+		const FVector B = Sites[Vtx.Y] - P;
+		const FVector C = Sites[Vtx.Z] - P;
+		const FVector D = Sites[Vtx.W] - P;
+
+		auto Triple = [](const FVector& U, const FVector& V, const FVector& W) { return FVector::DotProduct(U, FVector::CrossProduct(V, W)); };
+
+		return A.SizeSquared() * Triple(B, C, D) -
+			B.SizeSquared() * Triple(A, C, D) +
+			C.SizeSquared() * Triple(A, B, D) -
+			D.SizeSquared() * Triple(A, B, C) > 0;
+	}
+
+	int32 FDelaunay3::Locate(const int32 Site) const
+	{
+		const FVector& P = Sites[Site];
+		const int32 MaxSteps = Cells.Num();
+
+		int32 Cell = LastCell;
+		int32 Previous = -1;
+		uint32 Seed = static_cast<uint32>(Site) * 2654435761u + 1;
+
+		for (int Step = 0; Step < MaxSteps; Step++)
+		{
+			const FIntVector4& Vtx = Cells[Cell];
+
+			// Randomize the first face tested and never step back, so degenerate walks don't cycle
+			Seed ^= Seed << 13;
+			Seed ^= Seed >> 17;
+			Seed ^= Seed << 5;
+			const int32 Offset = Seed & 3;
+
+			bool bMoved = false;
+			for (int k = 0; k < 4; k++)
+			{
+				const int32 Face = (Offset + k) & 3;
+				const int32 Next = CellNeighbors[Cell][Face];
+				if (Next == Previous) { continue; }
+
+				if (Orient(
+					Sites[Vtx[FaceVertices[Face][0]]],
+					Sites[Vtx[FaceVertices[Face][1]]],
+					Sites[Vtx[FaceVertices[Face][2]]], P) >= 0) { continue; }
+
+				if (Next == -1) { return -1; }
+
+				Previous = Cell;
+				Cell = Next;
+				bMoved = true;
+				break;
+			}
+
+			if (!bMoved) { return Cell; }
+		}
+
+		// Walk failed, any cell in conflict is a valid cavity seed
+		for (int i = 0; i < Cells.Num(); i++) { if (!CellDead[i] && InSphere(i, P)) { return i; } }
+
+		return -1;
+	}
+
+	bool FDelaunay3::Insert(const int32 Site)
+	{
+		const FVector& P = Sites[Site];
+
+		const int32 Start = Locate(Site);
+		if (Start == -1) { return false; }
+
+		Stamp++;
+		Cavity.Reset();
+		Cavity.Add(Start);
+		CavityStamp[Start] = Stamp;
+
+		for (int i = 0; i < Cavity.Num(); i++)
+		{
+			const int32 Cell = Cavity[i];
+
+			for (int Face = 0; Face < 4; Face++)
+			{
+				const int32 Adjacent = CellNeighbors[Cell][Face];
+				if (Adjacent != -1)
+				{
+					if (CavityStamp[Adjacent] == Stamp) { continue; }
+					if (InSphere(Adjacent, P))
+					{
+						CavityStamp[Adjacent] = Stamp;
+						Cavity.Add(Adjacent);
+						continue;
+					}
+				}
+
+				// Boundary face, must be visible from the inserted site
+				const FIntVector4& Vtx = Cells[Cell];
+				if (Orient(
+					Sites[Vtx[FaceVertices[Face][0]]],
+					Sites[Vtx[FaceVertices[Face][1]]],
+					Sites[Vtx[FaceVertices[Face][2]]], P) > 0) { continue; }
+
+				if (Adjacent == -1) { return false; }
+
+				CavityStamp[Adjacent] = Stamp;
+				Cavity.Add(Adjacent);
+			}
+		}
+
+		// Collect boundary faces before cavity cells get recycled
+		BoundaryFaces.Reset();
+		BoundaryLinks.Reset();
+
+		for (const int32 Cell : Cavity)
+		{
+			const FIntVector4& Vtx = Cells[Cell];
+			for (int Face = 0; Face < 4; Face++)
+			{
+				const int32 Adjacent = CellNeighbors[Cell][Face];
+				if (Adjacent != -1 && CavityStamp[Adjacent] == Stamp) { continue; }
+
+				BoundaryFaces.Emplace(Vtx[FaceVertices[Face][0]], Vtx[FaceVertices[Face][1]], Vtx[FaceVertices[Face][2]]);
+
+				int32 Link = -1;
+				if (Adjacent != -1)
+				{
+					const FIntVector4& AdjacentNeighbors = CellNeighbors[Adjacent];
+					for (int k = 0; k < 4; k++) { if (AdjacentNeighbors[k] == Cell) { Link = Adjacent * 4 + k; } }
+				}
+				BoundaryLinks.Add(Link);
+			}
+		}
+
+		for (const int32 Cell : Cavity)
+		{
+			CellDead[Cell] = true;
+			FreeCells.Add(Cell);
+		}
+
+		// Fill the cavity with cells connecting its boundary faces to the inserted site
+		OpenFaces.Reset();
+
+		for (int i = 0; i < BoundaryFaces.Num(); i++)
+		{
+			const FIntVector& FaceVtx = BoundaryFaces[i];
+			const int32 NewCell = AddCell(FaceVtx.X, FaceVtx.Y, FaceVtx.Z, Site);
+
+			if (const int32 Link = BoundaryLinks[i]; Link != -1)
+			{
+				CellNeighbors[NewCell][3] = Link / 4;
+				CellNeighbors[Link / 4][Link % 4] = NewCell;
+			}
+
+			// Faces opposite to each of the boundary face vertices are shared with other new cells
+			for (int k = 0; k < 3; k++)
+			{
+				const uint64 Key = PCGExGraph::FUnsignedEdge(FaceVtx[(k + 1) % 3], FaceVtx[(k + 2) % 3], EPCGExEdgeType::Unknown).GetUnsignedHash();
+				if (const int32* Other = OpenFaces.Find(Key))
+				{
+					CellNeighbors[NewCell][k] = *Other / 4;
+					CellNeighbors[*Other / 4][*Other % 4] = NewCell;
+					OpenFaces.Remove(Key);
+				}
+				else
+				{
+					OpenFaces.Add(Key, NewCell * 4 + k);
+				}
+			}
+
+			LastCell = NewCell;
+		}
+
+		return true;
+	}
+
+	bool FDelaunay3::Process(const TArray<FVector>& Positions)
+	{
+		Edges.Reset();
+		Tetrahedra.Reset();
+		NumSkippedSites = 0;
+
+		const int32 NumPositions = Positions.Num();
+		if (NumPositions < 4) { return false; }
+
+		// Normalize to a unit box to keep predicates well conditioned
+		FBox Bounds(ForceInit);
+		for (const FVector& Position : Positions) { Bounds += Position; }
+
+		// Flat inputs only produce slivers competing with the enclosing tetrahedron, they're a job for FDelaunay2
+		const FVector Extents = Bounds.GetExtent();
+		if (Extents.GetMin() <= Extents.GetMax() * 1e-4) { return false; }
+
+		const FVector Center = Bounds.GetCenter();
+		const double Scale = 1 / Extents.GetMax();
+
+		// Sort along a Morton curve, exact duplicates end up next to each other
+		TArray<uint64> Keys;
+		TArray<int32> Order;
+		Keys.SetNumUninitialized(NumPositions);
+		Order.SetNumUninitialized(NumPositions);
+
+		auto Spread = [](uint64 V)
+		{
+			V &= 0x3FF;
+			V = (V | (V << 16)) & 0x30000FF;
+			V = (V | (V << 8)) & 0x300F00F;
+			V = (V | (V << 4)) & 0x30C30C3;
+			V = (V | (V << 2)) & 0x9249249;
+			return V;
+		};
+
+		for (int i = 0; i < NumPositions; i++)
+		{
+			const FVector Local = ((Positions[i] - Center) * Scale + FVector::OneVector) * 511.5;
+			Keys[i] = Spread(static_cast<uint64>(Local.X)) | (Spread(static_cast<uint64>(Local.Y)) << 1) | (Spread(static_cast<uint64>(Local.Z)) << 2);
+			Order[i] = i;
+		}
+
+		Order.Sort(
+			[&](const int32 A, const int32 B)
+			{
+				if (Keys[A] != Keys[B]) { return Keys[A] < Keys[B]; }
+				const FVector& PA = Positions[A];
+				const FVector& PB = Positions[B];
+				if (PA.X != PB.X) { return PA.X < PB.X; }
+				if (PA.Y != PB.Y) { return PA.Y < PB.Y; }
+				return PA.Z < PB.Z;
+			});
+
+		Keys.Empty();
+
+		TArray<int32> SiteIndices;
+		SiteIndices.Reserve(NumPositions);
+		Sites.Reset(NumPositions + 4);
+
+		// Sites are nudged by a tiny deterministic offset so cospherical & coplanar inputs (grids)
+		// don't feed exact degeneracies to the predicates
+		const FRandomStream Random(NumPositions);
+		constexpr double Jitter = 1e-7;
+
+		for (const int32 Index : Order)
+		{
+			if (!SiteIndices.IsEmpty() && Positions[SiteIndices.Last()] == Positions[Index]) { continue; }
+			Sites.Add((Positions[Index] - Center) * Scale + Random.VRand() * Jitter);
+			SiteIndices.Add(Index);
+		}
+
+		Order.Empty();
+
+		const int32 NumSites = Sites.Num();
+
+		// Enclosing tetrahedron, far enough to have a negligible effect on hull cells
+		constexpr double Far = 1e4;
+		Sites.Emplace(Far, Far, Far);
+		Sites.Emplace(-Far, -Far, Far);
+		Sites.Emplace(-Far, Far, -Far);
+		Sites.Emplace(Far, -Far, -Far);
+
+		const int32 NumReserve = NumSites * 8;
+		Cells.Reset(NumReserve);
+		CellNeighbors.Reset(NumReserve);
+		CellDead.Reset(NumReserve);
+		CavityStamp.Reset(NumReserve);
+		FreeCells.Reset();
+		Stamp = 0;
+
+		if (Orient(Sites[NumSites], Sites[NumSites + 1], Sites[NumSites + 2], Sites[NumSites + 3]) > 0) { LastCell = AddCell(NumSites, NumSites + 1, NumSites + 2, NumSites + 3); }
+		else { LastCell = AddCell(NumSites, NumSites + 2, NumSites + 1, NumSites + 3); }
+
+		// Insertion only fails on numerically degenerate cavities; the site is then left out of the mesh
+		for (int i = 0; i < NumSites; i++) { if (!Insert(i)) { NumSkippedSites++; } }
+
+		TSet<uint64> UniqueEdges;
+		UniqueEdges.Reserve(Cells.Num());
+		Edges.Reserve(Cells.Num());
+		Tetrahedra.Reserve(Cells.Num());
+
+		for (int i = 0; i < Cells.Num(); i++)
+		{
+			if (CellDead[i]) { continue; }
+
+			const FIntVector4& Vtx = Cells[i];
+			if (Vtx.X >= NumSites || Vtx.Y >= NumSites || Vtx.Z >= NumSites || Vtx.W >= NumSites) { continue; }
+
+			const FIntVector4 Tetrahedron(SiteIndices[Vtx.X], SiteIndices[Vtx.Y], SiteIndices[Vtx.Z], SiteIndices[Vtx.W]);
+			Tetrahedra.Add(Tetrahedron);
+
+			for (int A = 0; A < 3; A++)
+			{
+				for (int B = A + 1; B < 4; B++)
+				{
+					const PCGExGraph::FUnsignedEdge Edge(Tetrahedron[A], Tetrahedron[B], EPCGExEdgeType::Complete);
+					bool bAlreadySet = false;
+					UniqueEdges.Add(Edge.GetUnsignedHash(), &bAlreadySet);
+					if (!bAlreadySet) { Edges.Add(Edge); }
+				}
+			}
+		}
+
+		UniqueEdges.Empty();
+		Sites.Empty();
+		Cells.Empty();
+		CellNeighbors.Empty();
+		CellDead.Empty();
+		CavityStamp.Empty();
+		Cavity.Empty();
+		FreeCells.Empty();
+		BoundaryFaces.Empty();
+		BoundaryLinks.Empty();
+		OpenFaces.Empty();
+
+		return !Tetrahedra.IsEmpty();
+	}
+
+#pragma endregion
+
+#pragma region Pruning
+
+	static void BuildAdjacency(const int32 NumPositions, const TArray<PCGExGraph::FUnsignedEdge>& Edges, TArray<int32>& OutOffsets, TArray<int32>& OutAdjacency)
+	{
+		OutOffsets.Init(0, NumPositions + 1);
+		for (const PCGExGraph::FUnsignedEdge& Edge : Edges)
+		{
+			OutOffsets[Edge.Start + 1]++;
+			OutOffsets[Edge.End + 1]++;
+		}
+
+		for (int i = 0; i < NumPositions; i++) { OutOffsets[i + 1] += OutOffsets[i]; }
+
+		TArray<int32> Cursor(OutOffsets.GetData(), NumPositions);
+		OutAdjacency.SetNumUninitialized(Edges.Num() * 2);
+		for (const PCGExGraph::FUnsignedEdge& Edge : Edges)
+		{
+			OutAdjacency[Cursor[Edge.Start]++] = Edge.End;
+			OutAdjacency[Cursor[Edge.End]++] = Edge.Start;
+		}
+	}
+
+	static void Compact(TArray<PCGExGraph::FUnsignedEdge>& Edges, const TArray<bool>& Keep)
+	{
+		int32 WriteIndex = 0;
+		for (int i = 0; i < Edges.Num(); i++) { if (Keep[i]) { Edges[WriteIndex++] = Edges[i]; } }
+		Edges.SetNum(WriteIndex);
+	}
+
+	void PruneGabriel(const TArray<FVector>& Positions, TArray<PCGExGraph::FUnsignedEdge>& Edges, const bool bParallel)
+	{
+		TArray<int32> Offsets;
+		TArray<int32> Adjacency;
+		BuildAdjacency(Positions.Num(), Edges, Offsets, Adjacency);
+
+		TArray<bool> Keep;
+		Keep.Init(true, Edges.Num());
+
+		ParallelFor(
+			Edges.Num(), [&](const int32 Index)
+			{
+				const PCGExGraph::FUnsignedEdge& Edge = Edges[Index];
+				const FVector Center = FMath::Lerp(Positions[Edge.Start], Positions[Edge.End], 0.5);
+				const double SquaredRadius = FVector::DistSquared(Positions[Edge.Start], Positions[Edge.End]) * 0.25;
+
+				for (int i = Offsets[Edge.Start]; i < Offsets[Edge.Start + 1]; i++)
+				{
+					const int32 Other = Adjacency[i];
+					if (Other == static_cast<int32>(Edge.End)) { continue; }
+					if (FVector::DistSquared(Positions[Other], Center) < SquaredRadius)
+					{
+						Keep[Index] = false;
+						return;
+					}
+				}
+			}, !bParallel);
+
+		Compact(Edges, Keep);
+	}
+
+	void PruneRelativeNeighborhood(const TArray<FVector>& Positions, TArray<PCGExGraph::FUnsignedEdge>& Edges, const bool bParallel)
+	{
+		TArray<int32> Offsets;
+		TArray<int32> Adjacency;
+		BuildAdjacency(Positions.Num(), Edges, Offsets, Adjacency);
+
+		TArray<bool> Keep;
+		Keep.Init(true, Edges.Num());
+
+		// Edges are processed in batches, each owning a visit stamp per site that is reused across its edges.
+		// Stamping with the edge index means the stamps never need to be cleared.
+		const int32 NumEdges = Edges.Num();
+		const int32 BatchSize = PCGExMT::GetBatchSize(NumEdges, 256);
+		const int32 NumBatches = FMath::DivideAndRoundUp(NumEdges, BatchSize);
+
+		ParallelFor(
+			NumBatches, [&](const int32 BatchIndex)
+			{
+				TArray<int32> VisitStamps;
+				VisitStamps.Init(-1, Positions.Num());
+				TArray<int32> Stack;
+
+				auto IsBlocked = [&](const int32 Index)
+				{
+					const PCGExGraph::FUnsignedEdge& Edge = Edges[Index];
+					const int32 Start = Edge.Start;
+					const int32 End = Edge.End;
+					const FVector& A = Positions[Start];
+					const FVector& B = Positions[End];
+					const double SquaredLength = FVector::DistSquared(A, B);
+
+					// The lune fits in the disk centered on the edge with a radius of sqrt(3)/2 * length
+					const FVector Center = FMath::Lerp(A, B, 0.5);
+					const double SquaredRadius = SquaredLength * 0.75;
+
+					Stack.Reset();
+					VisitStamps[Start] = Index;
+					Stack.Add(Start);
+
+					while (!Stack.IsEmpty())
+					{
+						const int32 Current = Stack.Pop(false);
+						for (int i = Offsets[Current]; i < Offsets[Current + 1]; i++)
+						{
+							const int32 Other = Adjacency[i];
+							if (Other == End || VisitStamps[Other] == Index) { continue; }
+
+							const FVector& P = Positions[Other];
+							if (FVector::DistSquared(P, Center) > SquaredRadius) { continue; }
+
+							if (FVector::DistSquared(P, A) < SquaredLength && FVector::DistSquared(P, B) < SquaredLength) { return true; }
+
+							VisitStamps[Other] = Index;
+							Stack.Add(Other);
+						}
+					}
+
+					return false;
+				};
+
+				const int32 EndIndex = FMath::Min(NumEdges, (BatchIndex + 1) * BatchSize);
+				for (int Index = BatchIndex * BatchSize; Index < EndIndex; Index++) { if (IsBlocked(Index)) { Keep[Index] = false; } }
+			}, !bParallel);
+
+		Compact(Edges, Keep);
+	}
+
+	void PruneUrquhart(const TArray<FVector>& Positions, const TArray<FIntVector>& Triangles, TArray<PCGExGraph::FUnsignedEdge>& Edges)
+	{
+		TSet<uint64> Longest;
+		Longest.Reserve(Triangles.Num());
+
+		for (const FIntVector& Triangle : Triangles)
+		{
+			const double AB = FVector::DistSquared(Positions[Triangle.X], Positions[Triangle.Y]);
+			const double BC = FVector::DistSquared(Positions[Triangle.Y], Positions[Triangle.Z]);
+			const double CA = FVector::DistSquared(Positions[Triangle.Z], Positions[Triangle.X]);
+
+			if (AB >= BC && AB >= CA) { Longest.Add(PCGExGraph::FUnsignedEdge(Triangle.X, Triangle.Y, EPCGExEdgeType::Unknown).GetUnsignedHash()); }
+			else if (BC >= CA) { Longest.Add(PCGExGraph::FUnsignedEdge(Triangle.Y, Triangle.Z, EPCGExEdgeType::Unknown).GetUnsignedHash()); }
+			else { Longest.Add(PCGExGraph::FUnsignedEdge(Triangle.Z, Triangle.X, EPCGExEdgeType::Unknown).GetUnsignedHash()); }
+		}
+
+		Edges.RemoveAll([&](const PCGExGraph::FUnsignedEdge& Edge) { return Longest.Contains(Edge.GetUnsignedHash()); });
+	}
+
+#pragma endregion
+}
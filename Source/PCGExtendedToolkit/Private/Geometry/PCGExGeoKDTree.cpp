@@ -0,0 +1,165 @@
+﻿// Copyright Timothé Lapetite 2023
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Geometry/PCGExGeoKDTree.h"
+
+namespace PCGExGeo
+{
+	struct FKDCandidate
+	{
+		double DistSquared;
+		int32 Index;
+
+		FKDCandidate(const double InDistSquared, const int32 InIndex)
+			: DistSquared(InDistSquared), Index(InIndex)
+		{
+		}
+
+		// Max-heap on distance, so the farthest kept candidate is on top
+		bool operator<(const FKDCandidate& Other) const { return DistSquared > Other.DistSquared; }
+	};
+
+	FKDTree::~FKDTree()
+	{
+		Nodes.Empty();
+		Points.Empty();
+		Indices.Empty();
+	}
+
+	void FKDTree::Build(const TArray<FVector>& InPositions)
+	{
+		const int32 NumPositions = InPositions.Num();
+
+		Nodes.Reset(FMath::Max(1, 2 * NumPositions / LeafSize + 1));
+		Points.Reset(NumPositions);
+		Indices.SetNumUninitialized(NumPositions);
+
+		for (int i = 0; i < NumPositions; i++) { Indices[i] = i; }
+		Points.Append(InPositions);
+
+		if (NumPositions == 0) { return; }
+		BuildNode(0, NumPositions);
+	}
+
+	int32 FKDTree::BuildNode(const int32 Begin, const int32 End)
+	{
+		const int32 NodeIndex = Nodes.Emplace();
+		Nodes[NodeIndex].Begin = Begin;
+		Nodes[NodeIndex].End = End;
+
+		if (End - Begin <= LeafSize) { return NodeIndex; }
+
+		FBox Bounds(ForceInit);
+		for (int i = Begin; i < End; i++) { Bounds += Points[i]; }
+
+		const FVector Extents = Bounds.GetSize();
+		const int32 Axis = Extents.X >= Extents.Y && Extents.X >= Extents.Z ? 0 : Extents.Y >= Extents.Z ? 1 : 2;
+
+		// Quickselect the median along the split axis, keeping Points & Indices in sync
+		const int32 Mid = Begin + (End - Begin) / 2;
+		int32 Lo = Begin;
+		int32 Hi = End - 1;
+
+		while (Lo < Hi)
+		{
+			const double Pivot = Points[Lo + (Hi - Lo) / 2][Axis];
+			int32 i = Lo;
+			int32 j = Hi;
+
+			while (i <= j)
+			{
+				while (Points[i][Axis] < Pivot) { i++; }
+				while (Points[j][Axis] > Pivot) { j--; }
+				if (i <= j)
+				{
+					Swap(Points[i], Points[j]);
+					Swap(Indices[i], Indices[j]);
+					i++;
+					j--;
+				}
+			}
+
+			if (Mid <= j) { Hi = j; }
+			else if (Mid >= i) { Lo = i; }
+			else { break; }
+		}
+
+		const double Split = Points[Mid][Axis];
+		const int32 Left = BuildNode(Begin, Mid);
+		const int32 Right = BuildNode(Mid, End);
+
+		FNode& Node = Nodes[NodeIndex];
+		Node.Axis = Axis;
+		Node.Split = Split;
+		Node.Left = Left;
+		Node.Right = Right;
+
+		return NodeIndex;
+	}
+
+	void FKDTree::FindNearest(const FVector& Center, const int32 K, const double MaxDistanceSquared, TArray<int32>& OutNeighbors, const int32 Ignore) const
+	{
+		OutNeighbors.Reset();
+		if (K <= 0 || Nodes.IsEmpty()) { return; }
+
+		TArray<FKDCandidate, TInlineAllocator<32>> Heap;
+		Heap.Reserve(K);
+
+		// Pending far-side nodes, along with the squared distance to their splitting plane
+		TArray<TPair<int32, double>, TInlineAllocator<64>> Stack;
+		Stack.Emplace(0, 0);
+
+		double Bound = MaxDistanceSquared;
+
+		while (!Stack.IsEmpty())
+		{
+			const TPair<int32, double> Entry = Stack.Pop(false);
+			if (Entry.Value > Bound) { continue; }
+
+			int32 NodeIndex = Entry.Key;
+
+			// Descend to the leaf containing the center, deferring far sides
+			while (!Nodes[NodeIndex].IsLeaf())
+			{
+				const FNode& Node = Nodes[NodeIndex];
+				const double Delta = Center[Node.Axis] - Node.Split;
+				const double PlaneDistSquared = Delta * Delta;
+
+				if (Delta < 0)
+				{
+					if (PlaneDistSquared <= Bound) { Stack.Emplace(Node.Right, PlaneDistSquared); }
+					NodeIndex = Node.Left;
+				}
+				else
+				{
+					if (PlaneDistSquared <= Bound) { Stack.Emplace(Node.Left, PlaneDistSquared); }
+					NodeIndex = Node.Right;
+				}
+			}
+
+			const FNode& Leaf = Nodes[NodeIndex];
+			for (int i = Leaf.Begin; i < Leaf.End; i++)
+			{
+				const int32 Index = Indices[i];
+				if (Index == Ignore) { continue; }
+
+				const double DistSquared = FVector::DistSquared(Center, Points[i]);
+				if (DistSquared > Bound) { continue; }
+
+				if (Heap.Num() < K) { Heap.HeapPush(FKDCandidate(DistSquared, Index)); }
+				else if (DistSquared < Heap.HeapTop().DistSquared)
+				{
+					Heap.HeapPopDiscard(false);
+					Heap.HeapPush(FKDCandidate(DistSquared, Index));
+				}
+				else { continue; }
+
+				if (Heap.Num() == K) { Bound = Heap.HeapTop().DistSquared; }
+			}
+		}
+
+		Heap.Sort([](const FKDCandidate& A, const FKDCandidate& B) { return A.DistSquared < B.DistSquared; });
+		OutNeighbors.Reserve(Heap.Num());
+		for (const FKDCandidate& Candidate : Heap) { OutNeighbors.Add(Candidate.Index); }
+	}
+}
@@ -98,6 +98,13 @@ bool FPCGExBridgeEdgeIslandsElement::ExecuteInternal(
 				PCGE_LOG(Warning, GraphAndLog, FTEXT("Some input edges are invalid. This will highly likely cause unexpected results."));
 			}
 		}
+
+		// Add all bridges at once, tasks then write their own point
+		const int32 NumMeshes = Context->Meshes.Num();
+		const int32 NumBridges = Context->BridgeMethod == EPCGExBridgeIslandMethod::LeastEdges ? NumMeshes - 1 : (NumMeshes - 1) * (NumMeshes - 1);
+		Context->FirstBridgeIndex = Context->ConsolidatedEdges->AddPoints(NumBridges);
+		Context->ConsolidatedEdges->InitPoints(Context->FirstBridgeIndex, NumBridges, Context->bDoAsyncProcessing);
+
 		Context->SetState(PCGExGraph::State_ProcessingEdges);
 	}
 
@@ -124,14 +131,18 @@ bool FPCGExBridgeEdgeIslandsElement::ExecuteInternal(
 					}
 				}
 
-				Context->GetAsyncManager()->Start<FBridgeMeshesTask>(MeshIndex, Context->ConsolidatedEdges, Context->Meshes.IndexOfByKey(ClosestMesh));
+				Context->GetAsyncManager()->Start<FBridgeMeshesTask>(
+					MeshIndex, Context->ConsolidatedEdges,
+					Context->Meshes.IndexOfByKey(ClosestMesh), Context->FirstBridgeIndex + MeshIndex);
 			}
 			else if (Context->BridgeMethod == EPCGExBridgeIslandMethod::MostEdges)
 			{
 				for (int i = 0; i < Context->Meshes.Num(); i++)
 				{
 					if (CurrentMesh == Context->Meshes[i]) { continue; }
-					Context->GetAsyncManager()->Start<FBridgeMeshesTask>(MeshIndex, Context->ConsolidatedEdges, i);
+					Context->GetAsyncManager()->Start<FBridgeMeshesTask>(
+						MeshIndex, Context->ConsolidatedEdges,
+						i, Context->FirstBridgeIndex + MeshIndex * (Context->Meshes.Num() - 1) + (i < MeshIndex ? i : i - 1));
 				}
 			}
 		};
@@ -183,8 +194,7 @@ bool FBridgeMeshesTask::ExecuteTask()
 		}
 	}
 
-	int32 EdgeIndex = -1;
-	FPCGPoint& Bridge = Context->ConsolidatedEdges->NewPoint(EdgeIndex);
+	FPCGPoint& Bridge = PointIO->GetMutablePoint(BridgeIndex);
 	Bridge.Transform.SetLocation(
 		FMath::Lerp(
 			Context->CurrentIO->GetInPoint(IndexA).Transform.GetLocation(),
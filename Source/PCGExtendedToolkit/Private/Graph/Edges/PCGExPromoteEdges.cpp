@@ -33,6 +33,96 @@ TArray<FPCGPinProperties> UPCGExPromoteEdgesSettings::OutputPinProperties() cons
 
 FName UPCGExPromoteEdgesSettings::GetMainOutputLabel() const { return PCGExGraph::OutputPathsLabel; }
 
+void FPCGExPromoteEdgesContext::PreparePools()
+{
+	const int32 NumEdges = Edges.Num();
+	const int32 NumPointsPerEdge = Promotion->GetNumPointsPerEdge();
+
+	PooledData.Reset();
+	PooledIdAttributes.Reset();
+	EdgePools.SetNumUninitialized(NumEdges);
+	EdgePoolStartIndex.SetNumUninitialized(NumEdges);
+
+	TArray<int32> PoolSizes;
+
+	if (Promotion->PoolPerIsland())
+	{
+		// Union-find over vertices, path halving
+		TArray<int32> Parents;
+		const int32 NumVertices = CurrentIO->GetNum();
+		Parents.SetNumUninitialized(NumVertices);
+		for (int i = 0; i < NumVertices; i++) { Parents[i] = i; }
+
+		auto FindRoot = [&](int32 Index)
+		{
+			while (Parents[Index] != Index)
+			{
+				Parents[Index] = Parents[Parents[Index]];
+				Index = Parents[Index];
+			}
+			return Index;
+		};
+
+		for (const PCGExGraph::FUnsignedEdge& Edge : Edges)
+		{
+			const int32 RootA = FindRoot(Edge.Start);
+			const int32 RootB = FindRoot(Edge.End);
+			if (RootA != RootB) { Parents[RootA] = RootB; }
+		}
+
+		TArray<int32> RootToPool;
+		RootToPool.Init(-1, NumVertices);
+
+		for (int i = 0; i < NumEdges; i++)
+		{
+			int32& Pool = RootToPool[FindRoot(Edges[i].Start)];
+			if (Pool == -1) { Pool = PoolSizes.Add(0); }
+			EdgePools[i] = Pool;
+			EdgePoolStartIndex[i] = PoolSizes[Pool]++ * NumPointsPerEdge;
+		}
+	}
+	else
+	{
+		PoolSizes.Add(NumEdges);
+		for (int i = 0; i < NumEdges; i++)
+		{
+			EdgePools[i] = 0;
+			EdgePoolStartIndex[i] = i * NumPointsPerEdge;
+		}
+	}
+
+	const FName IdAttributeName = Promotion->GetPooledIdAttributeName();
+	const bool bWriteId = !IdAttributeName.IsNone() && FPCGMetadataAttributeBase::IsValidName(IdAttributeName);
+
+	for (const int32 PoolSize : PoolSizes)
+	{
+		UPCGPointData* OutData = NewObject<UPCGPointData>();
+		OutData->InitializeFromData(CurrentIO->GetIn());
+		OutData->GetMutablePoints().SetNum(PoolSize * NumPointsPerEdge);
+
+		PooledData.Add(OutData);
+		PooledIdAttributes.Add(bWriteId ? OutData->Metadata->FindOrCreateAttribute<int32>(IdAttributeName, -1, false) : nullptr);
+	}
+}
+
+void FPCGExPromoteEdgesContext::OutputPools()
+{
+	for (UPCGPointData* OutData : PooledData)
+	{
+		if (OutData->GetPoints().IsEmpty())
+		{
+			OutData->ConditionalBeginDestroy();
+			continue;
+		}
+		Output(OutData, CurrentIO->DefaultOutputLabel);
+	}
+
+	PooledData.Empty();
+	PooledIdAttributes.Empty();
+	EdgePools.Empty();
+	EdgePoolStartIndex.Empty();
+}
+
 PCGEX_INITIALIZE_ELEMENT(PromoteEdges)
 
 bool FPCGExPromoteEdgesElement::Boot(FPCGContext* InContext) const
@@ -65,7 +155,7 @@ bool FPCGExPromoteEdgesElement::ExecuteInternal(
 			Context->MaxPossibleEdgesPerPoint += Graph->GetSocketMapping()->NumSockets;
 		}
 
-		if (Context->Promotion->GeneratesNewPointData())
+		if (Context->Promotion->GeneratesNewPointData() && !Context->Promotion->GeneratesPooledPointData())
 		{
 			int32 MaxPossibleOutputs = 0;
 			for (const PCGExData::FPointIO* PointIO : Context->MainPoints->Pairs)
@@ -87,9 +177,8 @@ bool FPCGExPromoteEdgesElement::ExecuteInternal(
 		else
 		{
 			const int32 MaxNumEdges = (Context->MaxPossibleEdgesPerPoint * Context->CurrentIO->GetNum()) / 2; // Oof
-			Context->Edges.Reset(MaxNumEdges);
-			Context->UniqueEdges.Reset();
-			Context->UniqueEdges.Reserve(MaxNumEdges);
+			Context->Edges.Reset();
+			Context->UniqueEdges.Reset(MaxNumEdges);
 			Context->SetState(PCGExGraph::State_ReadyForNextGraph);
 		}
 	}
@@ -98,6 +187,9 @@ bool FPCGExPromoteEdgesElement::ExecuteInternal(
 	{
 		if (!Context->AdvanceGraph())
 		{
+			Context->UniqueEdges.Gather(Context->Edges);
+			Context->UniqueEdges.Reset();
+			if (Context->Promotion->GeneratesPooledPointData()) { Context->PreparePools(); }
 			Context->SetState(PCGExGraph::State_PromotingEdges);
 			return false;
 		}
@@ -116,21 +208,7 @@ bool FPCGExPromoteEdgesElement::ExecuteInternal(
 			TArray<PCGExGraph::FUnsignedEdge> UnsignedEdges;
 			Context->CurrentGraph->GetEdges(PointIndex, UnsignedEdges, Context->EdgeType);
 
-			for (const PCGExGraph::FUnsignedEdge& UEdge : UnsignedEdges)
-			{
-				Context->EdgeLock.ReadLock();
-				if (Context->UniqueEdges.Contains(UEdge.GetUnsignedHash()))
-				{
-					Context->EdgeLock.ReadUnlock();
-					continue;
-				}
-				Context->EdgeLock.ReadUnlock();
-
-				Context->EdgeLock.WriteLock();
-				Context->UniqueEdges.Add(UEdge.GetUnsignedHash());
-				Context->Edges.Add(UEdge);
-				Context->EdgeLock.WriteUnlock();
-			}
+			for (const PCGExGraph::FUnsignedEdge& UEdge : UnsignedEdges) { Context->UniqueEdges.Add(UEdge); }
 		};
 
 
@@ -165,11 +243,7 @@ bool FPCGExPromoteEdgesElement::ExecuteInternal(
 				Context->CurrentIO->GetInPoint(UEdge.Start),
 				Context->CurrentIO->GetInPoint(UEdge.End)))
 			{
-				Context->EdgeLock.WriteLock();
-				FPCGTaggedData& OutputRef = Context->OutputData.TaggedData.Emplace_GetRef();
-				OutputRef.Data = OutData;
-				OutputRef.Pin = Context->CurrentIO->DefaultOutputLabel;
-				Context->EdgeLock.WriteUnlock();
+				Context->Output(OutData, Context->CurrentIO->DefaultOutputLabel);
 			}
 			else
 			{
@@ -177,7 +251,36 @@ bool FPCGExPromoteEdgesElement::ExecuteInternal(
 			}
 		};
 
-		if (Context->Promotion->GeneratesNewPointData())
+		auto ProcessEdgePooled = [&](const int32 Index)
+		{
+			const PCGExGraph::FUnsignedEdge& UEdge = Context->Edges[Index];
+			const int32 Pool = Context->EdgePools[Index];
+			const int32 StartIndex = Context->EdgePoolStartIndex[Index];
+			UPCGPointData* OutData = Context->PooledData[Pool];
+
+			if (!Context->Promotion->PromoteEdgePooled(
+				OutData, StartIndex,
+				UEdge,
+				Context->CurrentIO->GetInPoint(UEdge.Start),
+				Context->CurrentIO->GetInPoint(UEdge.End))) { return; }
+
+			if (FPCGMetadataAttribute<int32>* IdAttribute = Context->PooledIdAttributes[Pool])
+			{
+				const TArray<FPCGPoint>& OutPoints = OutData->GetPoints();
+				const int32 EndIndex = StartIndex + Context->Promotion->GetNumPointsPerEdge();
+				for (int i = StartIndex; i < EndIndex; i++) { IdAttribute->SetValue(OutPoints[i].MetadataEntry, Index); }
+			}
+		};
+
+		if (Context->Promotion->GeneratesPooledPointData())
+		{
+			if (Context->Process(ProcessEdgePooled, Context->Edges.Num()))
+			{
+				Context->OutputPools();
+				Context->SetState(PCGExMT::State_ReadyForNextPoints);
+			}
+		}
+		else if (Context->Promotion->GeneratesNewPointData())
 		{
 			if (Context->Process(ProcessEdgeGen, Context->Edges.Num())) { Context->SetState(PCGExMT::State_ReadyForNextPoints); }
 		}
@@ -189,7 +292,7 @@ bool FPCGExPromoteEdgesElement::ExecuteInternal(
 
 	if (Context->IsDone())
 	{
-		Context->UniqueEdges.Empty();
+		Context->UniqueEdges.Reset();
 		Context->Edges.Empty();
 
 		UE_LOG(LogTemp, Warning, TEXT("Actual Outputs = %d"), Context->OutputData.TaggedData.Num());
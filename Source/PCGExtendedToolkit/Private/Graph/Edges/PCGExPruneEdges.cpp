@@ -3,6 +3,9 @@
 
 #include "Graph/Edges/PCGExPruneEdges.h"
 
+#include "Data/PCGExClusterData.h"
+#include "Graph/Edges/Pruning/PCGExEdgePruneByLength.h"
+
 #define LOCTEXT_NAMESPACE "PCGExPruneEdges"
 #define PCGEX_NAMESPACE PruneEdges
 
@@ -10,18 +13,54 @@ UPCGExPruneEdgesSettings::UPCGExPruneEdgesSettings(
 	const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
+	PCGEX_OPERATION_DEFAULT(Pruning, UPCGExEdgePruneByLength)
 }
 
-PCGExData::EInit UPCGExPruneEdgesSettings::GetEdgeOutputInitMode() const { return PCGExData::EInit::DuplicateInput; }
+PCGExData::EInit UPCGExPruneEdgesSettings::GetEdgeOutputInitMode() const { return PCGExData::EInit::NoOutput; }
 
 PCGEX_INITIALIZE_ELEMENT(PruneEdges)
 
+FPCGExPruneEdgesContext::~FPCGExPruneEdgesContext()
+{
+	PCGEX_TERMINATE_ASYNC
+
+	Pruned.Empty();
+}
+
+void FPCGExPruneEdgesContext::WriteSurvivingEdges()
+{
+	// Surviving edge points are copied as-is; their metadata entries stay valid through the parent metadata
+	CurrentEdges->InitializeOutput<UPCGExClusterEdgesData>(PCGExData::EInit::NewOutput);
+
+	const TArray<FPCGPoint>& InEdgePoints = CurrentEdges->GetIn()->GetPoints();
+	TArray<FPCGPoint>& OutEdgePoints = CurrentEdges->GetOut()->GetMutablePoints();
+	OutEdgePoints.Reserve(CurrentMesh->Edges.Num());
+
+	const TSharedPtr<PCGExMesh::FClusterTopology> Topology = MakeShared<PCGExMesh::FClusterTopology>();
+	Topology->IslandID = CurrentMesh->MeshID;
+	Topology->EdgeStart.Reserve(CurrentMesh->Edges.Num());
+	Topology->EdgeEnd.Reserve(CurrentMesh->Edges.Num());
+
+	for (const PCGExMesh::FIndexedEdge& Edge : CurrentMesh->Edges)
+	{
+		if (Pruned[Edge.Index]) { continue; }
+		OutEdgePoints.Add(InEdgePoints[Edge.Index]);
+		Topology->EdgeStart.Add(Edge.Start);
+		Topology->EdgeEnd.Add(Edge.End);
+	}
+
+	Topology->Build(CurrentIO->GetNum());
+	Cast<UPCGExClusterEdgesData>(CurrentEdges->GetOut())->SetTopology(Topology);
+}
+
 bool FPCGExPruneEdgesElement::Boot(FPCGContext* InContext) const
 {
 	if (!FPCGExEdgesProcessorElement::Boot(InContext)) { return false; }
 
 	PCGEX_CONTEXT_AND_SETTINGS(PruneEdges)
 
+	PCGEX_OPERATION_BIND(Pruning, UPCGExEdgePruneByLength)
+
 	return true;
 }
 
@@ -58,25 +97,30 @@ bool FPCGExPruneEdgesElement::ExecuteInternal(
 	if (Context->IsState(PCGExGraph::State_ReadyForNextEdges))
 	{
 		if (!Context->AdvanceEdges()) { Context->SetState(PCGExMT::State_ReadyForNextPoints); }
-		else { Context->SetState(PCGExGraph::State_ProcessingEdges); }
+		else
+		{
+			// Invalid edges are not part of the mesh and start pruned
+			Context->Pruned.Init(true, Context->CurrentEdges->GetNum());
+			for (const PCGExMesh::FIndexedEdge& Edge : Context->CurrentMesh->Edges) { Context->Pruned[Edge.Index] = false; }
+
+			Context->Pruning->PrepareForMesh(*Context->CurrentIO, Context->CurrentMesh, &Context->Pruned);
+			Context->SetState(PCGExGraph::State_ProcessingEdges);
+		}
 	}
 
 	if (Context->IsState(PCGExGraph::State_ProcessingEdges))
 	{
-		auto Initialize = [&](const PCGExData::FPointIO& PointIO)
-		{
-		};
+		auto ProcessEdge = [&](const int32 EdgeIndex) { Context->Pruning->ProcessEdge(EdgeIndex); };
 
-		auto ProcessPoint = [&](const int32 PointIndex, const PCGExData::FPointIO& PointIO)
-		{
-		};
-
-		if (Context->ProcessCurrentPoints(Initialize, ProcessPoint))
+		if (Context->ProcessCurrentEdges(ProcessEdge))
 		{
+			Context->WriteSurvivingEdges();
 			Context->SetState(PCGExGraph::State_ReadyForNextEdges);
 		}
 	}
 
+	if (Context->IsDone()) { Context->OutputPointsAndEdges(); }
+
 	return Context->IsDone();
 }
 
@@ -3,6 +3,7 @@
 
 #include "Graph/Edges/PCGExRelaxEdgeIslands.h"
 
+#include "Async/ParallelFor.h"
 #include "Graph/Edges/Relaxing/PCGExEdgeRelaxingOperation.h"
 #include "Graph/Edges/Relaxing/PCGExForceDirectedRelaxing.h"
 
@@ -28,6 +29,9 @@ FPCGExRelaxEdgeIslandsContext::~FPCGExRelaxEdgeIslandsContext()
 	SecondaryBuffer.Empty();
 
 	InfluenceGetter.Cleanup();
+
+	PCGEX_DELETE(ResidualWriter)
+	PCGEX_DELETE(IterationCountWriter)
 }
 
 bool FPCGExRelaxEdgeIslandsElement::Boot(FPCGContext* InContext) const
@@ -37,8 +41,21 @@ bool FPCGExRelaxEdgeIslandsElement::Boot(FPCGContext* InContext) const
 	PCGEX_CONTEXT_AND_SETTINGS(RelaxEdgeIslands)
 
 	Context->Iterations = FMath::Max(Settings->Iterations, 1);
+	Context->IterationsPerDispatch = FMath::Max(Settings->IterationsPerDispatch, 1);
 	PCGEX_FWD(bUseLocalInfluence)
 
+	PCGEX_FWD(bUseConvergenceThreshold)
+	Context->ConvergenceThreshold = FMath::Max(Settings->ConvergenceThreshold, 0.0);
+	PCGEX_FWD(ConvergenceMetric)
+
+	PCGEX_FWD(bWriteResidual)
+	PCGEX_FWD(ResidualAttributeName)
+	PCGEX_FWD(bWriteIterationCount)
+	PCGEX_FWD(IterationCountAttributeName)
+
+	if (Context->bWriteResidual) { PCGEX_VALIDATE_NAME(Context->ResidualAttributeName) }
+	if (Context->bWriteIterationCount) { PCGEX_VALIDATE_NAME(Context->IterationCountAttributeName) }
+
 	PCGEX_OPERATION_BIND(Relaxing, UPCGExForceDirectedRelaxing)
 
 	Context->InfluenceGetter.Capture(Settings->LocalInfluence);
@@ -74,8 +91,14 @@ bool FPCGExRelaxEdgeIslandsElement::ExecuteInternal(FPCGContext* InContext) cons
 			else { Context->InfluenceGetter.bEnabled = false; }
 
 			Context->Relaxing->WriteActiveBuffer(*Context->CurrentIO, Context->InfluenceGetter);
+
+			if (Context->ResidualWriter) { Context->ResidualWriter->Write(); }
+			if (Context->IterationCountWriter) { Context->IterationCountWriter->Write(); }
 		}
 
+		PCGEX_DELETE(Context->ResidualWriter)
+		PCGEX_DELETE(Context->IterationCountWriter)
+
 		if (!Context->AdvanceAndBindPointsIO()) { Context->Done(); }
 		else
 		{
@@ -99,6 +122,20 @@ bool FPCGExRelaxEdgeIslandsElement::ExecuteInternal(FPCGContext* InContext) cons
 
 				Context->Relaxing->PrepareForPointIO(*Context->CurrentIO);
 
+				if (Context->bWriteResidual || Context->bWriteIterationCount) { Context->CurrentIO->CreateOutKeys(); }
+
+				if (Context->bWriteResidual)
+				{
+					Context->ResidualWriter = new PCGEx::TFAttributeWriter<double>(Context->ResidualAttributeName, 0, false);
+					Context->ResidualWriter->BindAndGet(*Context->CurrentIO);
+				}
+
+				if (Context->bWriteIterationCount)
+				{
+					Context->IterationCountWriter = new PCGEx::TFAttributeWriter<int32>(Context->IterationCountAttributeName, 0, false);
+					Context->IterationCountWriter->BindAndGet(*Context->CurrentIO);
+				}
+
 				Context->SetState(PCGExGraph::State_ReadyForNextEdges);
 			}
 		}
@@ -109,6 +146,9 @@ bool FPCGExRelaxEdgeIslandsElement::ExecuteInternal(FPCGContext* InContext) cons
 		if (!Context->AdvanceEdges()) { Context->SetState(PCGExMT::State_ReadyForNextPoints); }
 		else
 		{
+			Context->CurrentIteration = 0;
+			Context->bConverged = false;
+			Context->Residual = 0;
 			Context->Relaxing->PrepareForMesh(*Context->CurrentEdges, Context->CurrentMesh);
 			Context->SetState(PCGExGraph::State_ProcessingEdges);
 		}
@@ -116,24 +156,32 @@ bool FPCGExRelaxEdgeIslandsElement::ExecuteInternal(FPCGContext* InContext) cons
 
 	if (Context->IsState(PCGExGraph::State_ProcessingEdges))
 	{
-		auto Initialize = [&]()
+		if (Context->bConverged || Context->CurrentIteration >= Context->Iterations)
 		{
-			Context->Relaxing->PrepareForIteration(Context->CurrentIteration, &Context->PrimaryBuffer, &Context->SecondaryBuffer);
-		};
+			// Clusters may stop on different iterations; sync both buffers so the dump doesn't depend on parity
+			const TArray<FVector>& FinalBuffer = *Context->Relaxing->GetWriteBuffer();
+			TArray<FVector>& OtherBuffer = &FinalBuffer == &Context->PrimaryBuffer ? Context->SecondaryBuffer : Context->PrimaryBuffer;
 
-		auto ProcessVertex = [&](const int32 VertexIndex)
-		{
-			const PCGExMesh::FVertex& Vtx = Context->CurrentMesh->Vertices[VertexIndex];
-			Context->Relaxing->ProcessVertex(Vtx);
-		};
+			for (const PCGExMesh::FVertex& Vtx : Context->CurrentMesh->Vertices)
+			{
+				OtherBuffer[Vtx.PointIndex] = FinalBuffer[Vtx.PointIndex];
+				if (Context->ResidualWriter) { Context->ResidualWriter->Values[Vtx.PointIndex] = Context->Residual; }
+				if (Context->IterationCountWriter) { Context->IterationCountWriter->Values[Vtx.PointIndex] = Context->CurrentIteration; }
+			}
 
-		while (Context->CurrentIteration != Context->Iterations)
+			Context->SetState(PCGExGraph::State_ReadyForNextEdges);
+		}
+		else
 		{
-			if (Context->ProcessCurrentMesh(Initialize, ProcessVertex)) { Context->CurrentIteration++; }
-			return false;
+			const int32 NumIterations = FMath::Min(Context->IterationsPerDispatch, Context->Iterations - Context->CurrentIteration);
+			Context->GetAsyncManager()->Start<FPCGExRelaxMeshTask>(Context->CurrentIteration, Context->CurrentIO, NumIterations);
+			Context->SetAsyncState(PCGExMT::State_WaitingOnAsyncWork);
 		}
+	}
 
-		Context->SetState(PCGExGraph::State_ReadyForNextEdges);
+	if (Context->IsState(PCGExMT::State_WaitingOnAsyncWork))
+	{
+		if (Context->IsAsyncWorkComplete()) { Context->SetState(PCGExGraph::State_ProcessingEdges); }
 	}
 
 	if (Context->IsDone()) { Context->OutputPointsAndEdges(); }
@@ -141,5 +189,91 @@ bool FPCGExRelaxEdgeIslandsElement::ExecuteInternal(FPCGContext* InContext) cons
 	return Context->IsDone();
 }
 
+bool FPCGExRelaxMeshTask::ExecuteTask()
+{
+	FPCGExRelaxEdgeIslandsContext* Context = Manager->GetContext<FPCGExRelaxEdgeIslandsContext>();
+	const TArray<PCGExMesh::FVertex>& Vertices = Context->CurrentMesh->Vertices;
+
+	const int32 NumVertices = Vertices.Num();
+	const int32 ChunkSize = FMath::Max(Context->ChunkSize, 1);
+	const int32 NumChunks = FMath::DivideAndRoundUp(NumVertices, ChunkSize);
+	const bool bBatched = Context->Relaxing->IsBatched();
+
+	// Per-chunk displacement, reduced once the iteration is complete
+	TArray<double> ChunkMax;
+	TArray<double> ChunkSum;
+	if (Context->bUseConvergenceThreshold || Context->bWriteResidual)
+	{
+		ChunkMax.SetNumZeroed(NumChunks);
+		ChunkSum.SetNumZeroed(NumChunks);
+	}
+
+	for (int i = 0; i < NumIterations; i++)
+	{
+		PCGEX_ASYNC_CHECKPOINT
+
+		const int32 Iteration = TaskIndex + i;
+		Context->Relaxing->PrepareForIteration(Iteration, &Context->PrimaryBuffer, &Context->SecondaryBuffer);
+
+		const bool bMeasure = Context->bUseConvergenceThreshold || (Context->bWriteResidual && Iteration == Context->Iterations - 1);
+		const TArray<FVector>& ReadBuffer = *Context->Relaxing->GetReadBuffer();
+		const TArray<FVector>& WriteBuffer = *Context->Relaxing->GetWriteBuffer();
+
+		if (bBatched)
+		{
+			Context->Relaxing->ProcessIteration(Context->bDoAsyncProcessing);
+			if (!bMeasure)
+			{
+				Context->CurrentIteration = Iteration + 1;
+				continue;
+			}
+		}
+
+		ParallelFor(
+			NumChunks, [&](const int32 ChunkIndex)
+			{
+				const int32 Start = ChunkIndex * ChunkSize;
+				const int32 End = FMath::Min(Start + ChunkSize, NumVertices);
+				if (!bBatched) { for (int j = Start; j < End; j++) { Context->Relaxing->ProcessVertex(Vertices[j]); } }
+
+				if (!bMeasure) { return; }
+
+				double Max = 0;
+				double Sum = 0;
+				for (int j = Start; j < End; j++)
+				{
+					const int32 PointIndex = Vertices[j].PointIndex;
+					const double Displacement = FVector::Dist(ReadBuffer[PointIndex], WriteBuffer[PointIndex]);
+					Max = FMath::Max(Max, Displacement);
+					Sum += Displacement;
+				}
+				ChunkMax[ChunkIndex] = Max;
+				ChunkSum[ChunkIndex] = Sum;
+			}, !Context->bDoAsyncProcessing);
+
+		Context->CurrentIteration = Iteration + 1;
+
+		if (!bMeasure) { continue; }
+
+		double Max = 0;
+		double Sum = 0;
+		for (int j = 0; j < NumChunks; j++)
+		{
+			Max = FMath::Max(Max, ChunkMax[j]);
+			Sum += ChunkSum[j];
+		}
+
+		Context->Residual = Context->ConvergenceMetric == EPCGExRelaxConvergenceMetric::Max ? Max : Sum / FMath::Max(1, NumVertices);
+
+		if (Context->bUseConvergenceThreshold && Context->Residual <= Context->ConvergenceThreshold)
+		{
+			Context->bConverged = true;
+			break;
+		}
+	}
+
+	return true;
+}
+
 #undef LOCTEXT_NAMESPACE
 #undef PCGEX_NAMESPACE
@@ -4,6 +4,8 @@
 
 #include "Graph/Edges/Promoting/PCGExEdgePromoteToPath.h"
 
+#include "PCGExPointsProcessor.h"
+
 bool UPCGExEdgePromoteToPath::GeneratesNewPointData() { return true; }
 
 bool UPCGExEdgePromoteToPath::PromoteEdgeGen(UPCGPointData* InData, const PCGExGraph::FUnsignedEdge& Edge, const FPCGPoint& StartPoint, const FPCGPoint& EndPoint)
@@ -13,3 +15,25 @@ bool UPCGExEdgePromoteToPath::PromoteEdgeGen(UPCGPointData* InData, const PCGExG
 	MutablePoints.Emplace_GetRef(EndPoint);
 	return true;
 }
+
+bool UPCGExEdgePromoteToPath::GeneratesPooledPointData() { return OutputMode != EPCGExEdgePathOutputMode::PerEdge; }
+
+bool UPCGExEdgePromoteToPath::PoolPerIsland() { return OutputMode == EPCGExEdgePathOutputMode::PerIsland; }
+
+FName UPCGExEdgePromoteToPath::GetPooledIdAttributeName() { return PathIdAttributeName; }
+
+int32 UPCGExEdgePromoteToPath::GetNumPointsPerEdge() { return 2; }
+
+bool UPCGExEdgePromoteToPath::PromoteEdgePooled(UPCGPointData* InData, const int32 StartIndex, const PCGExGraph::FUnsignedEdge& Edge, const FPCGPoint& StartPoint, const FPCGPoint& EndPoint)
+{
+	const UPCGMetadata* InMetadata = Context->CurrentIO->GetIn()->Metadata;
+	TArray<FPCGPoint>& MutablePoints = InData->GetMutablePoints();
+
+	FPCGPoint& Start = MutablePoints[StartIndex] = StartPoint;
+	InData->Metadata->InitializeOnSet(Start.MetadataEntry, StartPoint.MetadataEntry, InMetadata);
+
+	FPCGPoint& End = MutablePoints[StartIndex + 1] = EndPoint;
+	InData->Metadata->InitializeOnSet(End.MetadataEntry, EndPoint.MetadataEntry, InMetadata);
+
+	return true;
+}
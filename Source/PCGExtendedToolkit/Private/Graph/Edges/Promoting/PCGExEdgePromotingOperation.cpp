@@ -14,3 +14,16 @@ bool UPCGExEdgePromotingOperation::PromoteEdgeGen(UPCGPointData* InData, const P
 {
 	return false;
 }
+
+bool UPCGExEdgePromotingOperation::GeneratesPooledPointData() { return false; }
+
+bool UPCGExEdgePromotingOperation::PoolPerIsland() { return false; }
+
+FName UPCGExEdgePromotingOperation::GetPooledIdAttributeName() { return NAME_None; }
+
+int32 UPCGExEdgePromotingOperation::GetNumPointsPerEdge() { return 0; }
+
+bool UPCGExEdgePromotingOperation::PromoteEdgePooled(UPCGPointData* InData, const int32 StartIndex, const PCGExGraph::FUnsignedEdge& Edge, const FPCGPoint& StartPoint, const FPCGPoint& EndPoint)
+{
+	return false;
+}
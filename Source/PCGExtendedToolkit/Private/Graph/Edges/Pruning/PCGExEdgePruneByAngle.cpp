@@ -0,0 +1,46 @@
+﻿// Copyright Timothé Lapetite 2023
+// Released under the MIT license https://opensource.org/license/MIT/
+
+
+#include "Graph/Edges/Pruning/PCGExEdgePruneByAngle.h"
+
+#include "Graph/PCGExMesh.h"
+
+void UPCGExEdgePruneByAngle::PrepareForMesh(const PCGExData::FPointIO& PointIO, PCGExMesh::FMesh* Mesh, TArray<bool>* InPruned)
+{
+	Super::PrepareForMesh(PointIO, Mesh, InPruned);
+	MaxDot = FMath::Cos(FMath::DegreesToRadians(MinAngle));
+}
+
+void UPCGExEdgePruneByAngle::ProcessEdge(const int32 EdgeIndex)
+{
+	if (!IsValidEdge(EdgeIndex)) { return; }
+	if (IsShadowed(EdgeIndex, EdgeStartVertex[EdgeIndex]) ||
+		IsShadowed(EdgeIndex, EdgeEndVertex[EdgeIndex]))
+	{
+		(*Pruned)[EdgeIndex] = true;
+	}
+}
+
+bool UPCGExEdgePruneByAngle::IsShadowed(const int32 EdgeIndex, const int32 VertexIndex) const
+{
+	const PCGExMesh::FVertex& Vtx = CurrentMesh->Vertices[VertexIndex];
+	if (Vtx.Edges.Num() < 2) { return false; }
+
+	const FVector Direction = (CurrentMesh->Vertices[GetOtherVertex(EdgeIndex, VertexIndex)].Position - Vtx.Position).GetSafeNormal();
+	const double Length = EdgeLengths[EdgeIndex];
+
+	for (const int32 OtherEdge : Vtx.Edges)
+	{
+		if (OtherEdge == EdgeIndex) { continue; }
+
+		// Only a shorter edge (ties broken by index) can shadow this one
+		const double OtherLength = EdgeLengths[OtherEdge];
+		if (OtherLength > Length || (OtherLength == Length && OtherEdge > EdgeIndex)) { continue; }
+
+		const FVector OtherDirection = (CurrentMesh->Vertices[GetOtherVertex(OtherEdge, VertexIndex)].Position - Vtx.Position).GetSafeNormal();
+		if (FVector::DotProduct(Direction, OtherDirection) > MaxDot) { return true; }
+	}
+
+	return false;
+}
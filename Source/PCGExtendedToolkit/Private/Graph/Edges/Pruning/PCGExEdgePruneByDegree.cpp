@@ -0,0 +1,35 @@
+﻿// Copyright Timothé Lapetite 2023
+// Released under the MIT license https://opensource.org/license/MIT/
+
+
+#include "Graph/Edges/Pruning/PCGExEdgePruneByDegree.h"
+
+#include "Graph/PCGExMesh.h"
+
+void UPCGExEdgePruneByDegree::ProcessEdge(const int32 EdgeIndex)
+{
+	if (!IsValidEdge(EdgeIndex)) { return; }
+	if (IsOverCap(EdgeIndex, EdgeStartVertex[EdgeIndex]) ||
+		IsOverCap(EdgeIndex, EdgeEndVertex[EdgeIndex]))
+	{
+		(*Pruned)[EdgeIndex] = true;
+	}
+}
+
+bool UPCGExEdgePruneByDegree::IsOverCap(const int32 EdgeIndex, const int32 VertexIndex) const
+{
+	const PCGExMesh::FVertex& Vtx = CurrentMesh->Vertices[VertexIndex];
+	if (Vtx.Edges.Num() <= MaxDegree) { return false; }
+
+	// Rank among the vertex edges by length, ties broken by index
+	const double Length = EdgeLengths[EdgeIndex];
+	int32 Rank = 0;
+	for (const int32 OtherEdge : Vtx.Edges)
+	{
+		if (OtherEdge == EdgeIndex) { continue; }
+		const double OtherLength = EdgeLengths[OtherEdge];
+		if (OtherLength < Length || (OtherLength == Length && OtherEdge < EdgeIndex)) { Rank++; }
+	}
+
+	return Rank >= MaxDegree;
+}
@@ -0,0 +1,35 @@
+﻿// Copyright Timothé Lapetite 2023
+// Released under the MIT license https://opensource.org/license/MIT/
+
+
+#include "Graph/Edges/Pruning/PCGExEdgePruneByLength.h"
+
+void UPCGExEdgePruneByLength::PrepareForMesh(const PCGExData::FPointIO& PointIO, PCGExMesh::FMesh* Mesh, TArray<bool>* InPruned)
+{
+	Super::PrepareForMesh(PointIO, Mesh, InPruned);
+
+	TArray<double> SortedLengths;
+	SortedLengths.Reserve(EdgeLengths.Num());
+	for (int i = 0; i < EdgeLengths.Num(); i++) { if (IsValidEdge(i)) { SortedLengths.Add(EdgeLengths[i]); } }
+
+	MinLength = 0;
+	MaxLength = TNumericLimits<double>::Max();
+
+	if (SortedLengths.IsEmpty()) { return; }
+
+	SortedLengths.Sort();
+
+	const int32 LastIndex = SortedLengths.Num() - 1;
+	const double Lower = FMath::Min(LowerPercentile, UpperPercentile);
+	const double Upper = FMath::Max(LowerPercentile, UpperPercentile);
+
+	MinLength = SortedLengths[FMath::Clamp(FMath::FloorToInt32(Lower * LastIndex), 0, LastIndex)];
+	MaxLength = SortedLengths[FMath::Clamp(FMath::CeilToInt32(Upper * LastIndex), 0, LastIndex)];
+}
+
+void UPCGExEdgePruneByLength::ProcessEdge(const int32 EdgeIndex)
+{
+	if (!IsValidEdge(EdgeIndex)) { return; }
+	const double Length = EdgeLengths[EdgeIndex];
+	if (Length < MinLength || Length > MaxLength) { (*Pruned)[EdgeIndex] = true; }
+}
@@ -0,0 +1,53 @@
+﻿// Copyright Timothé Lapetite 2023
+// Released under the MIT license https://opensource.org/license/MIT/
+
+
+#include "Graph/Edges/Pruning/PCGExEdgePruneDangling.h"
+
+#include "Graph/PCGExMesh.h"
+
+void UPCGExEdgePruneDangling::PrepareForMesh(const PCGExData::FPointIO& PointIO, PCGExMesh::FMesh* Mesh, TArray<bool>* InPruned)
+{
+	Super::PrepareForMesh(PointIO, Mesh, InPruned);
+
+	// Peeling is inherently sequential, so it's done upfront rather than per-edge
+
+	const int32 NumVertices = Mesh->Vertices.Num();
+	TArray<int32> Degrees;
+	Degrees.SetNumUninitialized(NumVertices);
+
+	TArray<int32> Frontier;
+	for (int i = 0; i < NumVertices; i++)
+	{
+		Degrees[i] = Mesh->Vertices[i].Edges.Num();
+		if (Degrees[i] == 1) { Frontier.Add(i); }
+	}
+
+	TArray<int32> NextFrontier;
+	int32 Step = 0;
+
+	while (!Frontier.IsEmpty() && (MaxChainLength <= 0 || Step < MaxChainLength))
+	{
+		NextFrontier.Reset();
+
+		for (const int32 VertexIndex : Frontier)
+		{
+			if (Degrees[VertexIndex] != 1) { continue; }
+
+			for (const int32 EdgeIndex : Mesh->Vertices[VertexIndex].Edges)
+			{
+				if ((*Pruned)[EdgeIndex]) { continue; }
+
+				(*Pruned)[EdgeIndex] = true;
+				Degrees[VertexIndex] = 0;
+
+				const int32 OtherVertex = GetOtherVertex(EdgeIndex, VertexIndex);
+				if (--Degrees[OtherVertex] == 1) { NextFrontier.Add(OtherVertex); }
+				break;
+			}
+		}
+
+		Swap(Frontier, NextFrontier);
+		Step++;
+	}
+}
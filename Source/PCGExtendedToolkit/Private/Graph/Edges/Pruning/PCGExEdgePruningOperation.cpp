@@ -3,3 +3,41 @@
 
 
 #include "Graph/Edges/Pruning/PCGExEdgePruningOperation.h"
+
+#include "Graph/PCGExMesh.h"
+
+void UPCGExEdgePruningOperation::PrepareForMesh(const PCGExData::FPointIO& PointIO, PCGExMesh::FMesh* Mesh, TArray<bool>* InPruned)
+{
+	CurrentMesh = Mesh;
+	Pruned = InPruned;
+
+	const int32 NumEdges = InPruned->Num();
+	EdgeStartVertex.Init(-1, NumEdges);
+	EdgeEndVertex.Init(-1, NumEdges);
+	EdgeLengths.Init(0, NumEdges);
+
+	for (const PCGExMesh::FIndexedEdge& Edge : Mesh->Edges)
+	{
+		const PCGExMesh::FVertex& Start = Mesh->GetVertexFromPointIndex(Edge.Start);
+		const PCGExMesh::FVertex& End = Mesh->GetVertexFromPointIndex(Edge.End);
+		EdgeStartVertex[Edge.Index] = Start.MeshIndex;
+		EdgeEndVertex[Edge.Index] = End.MeshIndex;
+		EdgeLengths[Edge.Index] = FVector::Dist(Start.Position, End.Position);
+	}
+}
+
+void UPCGExEdgePruningOperation::ProcessEdge(const int32 EdgeIndex)
+{
+}
+
+void UPCGExEdgePruningOperation::Cleanup()
+{
+	CurrentMesh = nullptr;
+	Pruned = nullptr;
+
+	EdgeStartVertex.Empty();
+	EdgeEndVertex.Empty();
+	EdgeLengths.Empty();
+
+	Super::Cleanup();
+}
@@ -34,6 +34,10 @@ void UPCGExEdgeRelaxingOperation::ProcessVertex(const PCGExMesh::FVertex& Vertex
 {
 }
 
+void UPCGExEdgeRelaxingOperation::ProcessIteration(const bool bParallel)
+{
+}
+
 void UPCGExEdgeRelaxingOperation::WriteActiveBuffer(PCGExData::FPointIO& PointIO, PCGEx::FLocalSingleFieldGetter& Influence)
 {
 	TArray<FPCGPoint>& MutablePoints = PointIO.GetOut()->GetMutablePoints();
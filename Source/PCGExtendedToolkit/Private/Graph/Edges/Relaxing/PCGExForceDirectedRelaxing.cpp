@@ -4,8 +4,220 @@
 
 #include "Graph/Edges/Relaxing/PCGExForceDirectedRelaxing.h"
 
+#include "PCGExPointsProcessor.h"
+#include "Async/ParallelFor.h"
 #include "Graph/PCGExMesh.h"
 
+namespace PCGExRelaxing
+{
+	void FBarnesHutTree::Build(const TArray<FVector>& InPositions, const bool bParallel)
+	{
+		Positions = &InPositions;
+		Nodes.Reset();
+
+		const int32 NumItems = InPositions.Num();
+		Items.SetNumUninitialized(NumItems);
+		for (int i = 0; i < NumItems; i++) { Items[i] = i; }
+
+		if (NumItems == 0) { return; }
+
+		FBox Bounds(ForceInit);
+		for (const FVector& Position : InPositions) { Bounds += Position; }
+
+		FBarnesHutNode& Root = Nodes.Emplace_GetRef();
+		Root.Center = Bounds.GetCenter();
+		Root.Extent = FMath::Max(Bounds.GetExtent().GetMax(), KINDA_SMALL_NUMBER);
+		Root.Count = NumItems;
+
+		if (NumItems <= LeafSize)
+		{
+			UpdateMass(Nodes, 0);
+			return;
+		}
+
+		Split(Nodes, 0);
+
+		// Octants own disjoint item ranges, build them independently
+
+		TArray<TArray<FBarnesHutNode>> SubTrees;
+		SubTrees.SetNum(8);
+
+		ParallelFor(
+			8, [&](const int32 Octant)
+			{
+				TArray<FBarnesHutNode>& SubNodes = SubTrees[Octant];
+				SubNodes.Add(Nodes[1 + Octant]);
+				BuildRecursive(SubNodes, 0, 1);
+			}, !bParallel);
+
+		// Splice subtrees; local index 0 is the octant node itself, the rest is appended
+
+		for (int Octant = 0; Octant < 8; Octant++)
+		{
+			TArray<FBarnesHutNode>& SubNodes = SubTrees[Octant];
+			const int32 Offset = Nodes.Num() - 1;
+
+			for (FBarnesHutNode& SubNode : SubNodes) { if (SubNode.FirstChild != -1) { SubNode.FirstChild += Offset; } }
+
+			Nodes[1 + Octant] = SubNodes[0];
+			Nodes.Append(SubNodes.GetData() + 1, SubNodes.Num() - 1);
+		}
+
+		UpdateMass(Nodes, 0);
+	}
+
+	void FBarnesHutTree::Split(TArray<FBarnesHutNode>& InNodes, const int32 NodeIndex)
+	{
+		const FBarnesHutNode Node = InNodes[NodeIndex];
+		const TArray<FVector>& InPositions = *Positions;
+
+		int32 Counts[8] = {};
+		TArray<uint8> Octants;
+		Octants.SetNumUninitialized(Node.Count);
+
+		for (int i = 0; i < Node.Count; i++)
+		{
+			const FVector& Position = InPositions[Items[Node.Start + i]];
+			const uint8 Octant =
+				(Position.X >= Node.Center.X ? 1 : 0) |
+				(Position.Y >= Node.Center.Y ? 2 : 0) |
+				(Position.Z >= Node.Center.Z ? 4 : 0);
+			Octants[i] = Octant;
+			Counts[Octant]++;
+		}
+
+		int32 Offsets[8];
+		int32 Cursors[8];
+		int32 Sum = 0;
+		for (int i = 0; i < 8; i++)
+		{
+			Offsets[i] = Cursors[i] = Sum;
+			Sum += Counts[i];
+		}
+
+		TArray<int32> Sorted;
+		Sorted.SetNumUninitialized(Node.Count);
+		for (int i = 0; i < Node.Count; i++) { Sorted[Cursors[Octants[i]]++] = Items[Node.Start + i]; }
+		FMemory::Memcpy(Items.GetData() + Node.Start, Sorted.GetData(), Node.Count * sizeof(int32));
+
+		const double ChildExtent = Node.Extent * 0.5;
+		InNodes[NodeIndex].FirstChild = InNodes.Num();
+
+		for (int i = 0; i < 8; i++)
+		{
+			FBarnesHutNode& Child = InNodes.Emplace_GetRef();
+			Child.Center = Node.Center + FVector(
+				i & 1 ? ChildExtent : -ChildExtent,
+				i & 2 ? ChildExtent : -ChildExtent,
+				i & 4 ? ChildExtent : -ChildExtent);
+			Child.Extent = ChildExtent;
+			Child.Start = Node.Start + Offsets[i];
+			Child.Count = Counts[i];
+		}
+	}
+
+	void FBarnesHutTree::BuildRecursive(TArray<FBarnesHutNode>& InNodes, const int32 NodeIndex, const int32 Depth)
+	{
+		if (InNodes[NodeIndex].Count > LeafSize && Depth < MaxDepth)
+		{
+			Split(InNodes, NodeIndex);
+			const int32 FirstChild = InNodes[NodeIndex].FirstChild;
+			for (int i = 0; i < 8; i++) { BuildRecursive(InNodes, FirstChild + i, Depth + 1); }
+		}
+
+		UpdateMass(InNodes, NodeIndex);
+	}
+
+	void FBarnesHutTree::UpdateMass(TArray<FBarnesHutNode>& InNodes, const int32 NodeIndex) const
+	{
+		FBarnesHutNode& Node = InNodes[NodeIndex];
+		FVector WeightedSum = FVector::ZeroVector;
+		int32 Mass = 0;
+
+		if (Node.FirstChild == -1)
+		{
+			const TArray<FVector>& InPositions = *Positions;
+			for (int i = 0; i < Node.Count; i++) { WeightedSum += InPositions[Items[Node.Start + i]]; }
+			Mass = Node.Count;
+		}
+		else
+		{
+			for (int i = 0; i < 8; i++)
+			{
+				const FBarnesHutNode& Child = InNodes[Node.FirstChild + i];
+				WeightedSum += Child.CenterOfMass * Child.Mass;
+				Mass += Child.Mass;
+			}
+		}
+
+		Node.Mass = Mass;
+		Node.CenterOfMass = Mass > 0 ? WeightedSum / Mass : Node.Center;
+	}
+
+	void FBarnesHutTree::AccumulateRepulsion(FVector& Force, const int32 Item, const FVector& Position, const double Strength, const double Theta) const
+	{
+		if (Nodes.IsEmpty()) { return; }
+
+		const TArray<FVector>& InPositions = *Positions;
+		const double ThetaSquared = Theta * Theta;
+
+		auto AddRepulsion = [&](const FVector& Other, const double Magnitude)
+		{
+			FVector Displacement = Other - Position;
+			const double Distance = FMath::Max(Displacement.Length(), 1e-5);
+			Displacement /= Distance;
+			Force -= Displacement * (Magnitude / (Distance * Distance));
+		};
+
+		TArray<int32, TInlineAllocator<128>> Stack;
+		Stack.Add(0);
+
+		while (!Stack.IsEmpty())
+		{
+			const FBarnesHutNode& Node = Nodes[Stack.Pop()];
+			if (Node.Mass == 0) { continue; }
+
+			if (Node.FirstChild == -1)
+			{
+				for (int i = Node.Start; i < Node.Start + Node.Count; i++)
+				{
+					if (Items[i] == Item) { continue; }
+					AddRepulsion(InPositions[Items[i]], Strength);
+				}
+				continue;
+			}
+
+			// Always open the cell containing the processed position, otherwise with a large theta it may be
+			// approximated as a single distant mass that includes the item itself
+			const FVector Local = (Position - Node.Center).GetAbs();
+			const bool bContainsPosition = Local.X <= Node.Extent && Local.Y <= Node.Extent && Local.Z <= Node.Extent;
+
+			const double Size = Node.Extent * 2;
+			if (!bContainsPosition && Size * Size < ThetaSquared * FVector::DistSquared(Position, Node.CenterOfMass))
+			{
+				AddRepulsion(Node.CenterOfMass, Strength * Node.Mass);
+				continue;
+			}
+
+			for (int i = 0; i < 8; i++) { Stack.Add(Node.FirstChild + i); }
+		}
+	}
+}
+
+void UPCGExForceDirectedRelaxing::PrepareForIteration(const int Iteration, TArray<FVector>* PrimaryBuffer, TArray<FVector>* SecondaryBuffer)
+{
+	Super::PrepareForIteration(Iteration, PrimaryBuffer, SecondaryBuffer);
+
+	if (!bGlobalRepulsion) { return; }
+
+	const TArray<FVector>& Positions = *ReadBuffer;
+	const int32 NumVertices = CurrentMesh->Vertices.Num();
+	VertexPositions.SetNumUninitialized(NumVertices);
+	for (int i = 0; i < NumVertices; i++) { VertexPositions[i] = Positions[CurrentMesh->Vertices[i].PointIndex]; }
+
+	RepulsionTree.Build(VertexPositions, !Context || Context->bDoAsyncProcessing);
+}
+
 void UPCGExForceDirectedRelaxing::ProcessVertex(const PCGExMesh::FVertex& Vertex)
 {
 	const FVector Position = (*ReadBuffer)[Vertex.PointIndex];
@@ -16,12 +228,22 @@ void UPCGExForceDirectedRelaxing::ProcessVertex(const PCGExMesh::FVertex& Vertex
 		const PCGExMesh::FVertex& OtherVtx = CurrentMesh->Vertices[VtxIndex];
 		const FVector OtherPosition = (*ReadBuffer)[OtherVtx.PointIndex];
 		CalculateAttractiveForce(Force, Position, OtherPosition);
-		CalculateRepulsiveForce(Force, Position, OtherPosition);
+		if (!bGlobalRepulsion) { CalculateRepulsiveForce(Force, Position, OtherPosition); }
 	}
 
+	if (bGlobalRepulsion) { RepulsionTree.AccumulateRepulsion(Force, Vertex.MeshIndex, Position, ElectrostaticConstant, Theta); }
+
 	(*WriteBuffer)[Vertex.PointIndex] = Position + Force;
 }
 
+void UPCGExForceDirectedRelaxing::Cleanup()
+{
+	RepulsionTree.Nodes.Empty();
+	RepulsionTree.Items.Empty();
+	VertexPositions.Empty();
+	Super::Cleanup();
+}
+
 void UPCGExForceDirectedRelaxing::CalculateAttractiveForce(FVector& Force, const FVector& A, const FVector& B) const
 {
 	// Calculate the displacement vector between the nodes
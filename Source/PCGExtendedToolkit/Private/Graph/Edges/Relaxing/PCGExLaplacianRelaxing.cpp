@@ -0,0 +1,157 @@
+﻿// Copyright Timothé Lapetite 2023
+// Released under the MIT license https://opensource.org/license/MIT/
+
+
+#include "Graph/Edges/Relaxing/PCGExLaplacianRelaxing.h"
+
+#include "PCGExPointsProcessor.h"
+#include "Async/ParallelFor.h"
+#include "Graph/PCGExMesh.h"
+
+void UPCGExLaplacianRelaxing::PrepareForMesh(PCGExData::FPointIO& EdgesIO, PCGExMesh::FMesh* Mesh)
+{
+	Super::PrepareForMesh(EdgesIO, Mesh);
+
+	const int32 NumVertices = Mesh->Vertices.Num();
+
+	PointIndices.SetNumUninitialized(NumVertices);
+	AdjacencyOffsets.SetNumUninitialized(NumVertices + 1);
+	InvDegrees.SetNumUninitialized(NumVertices);
+	Adjacency.Reset();
+
+	AdjacencyOffsets[0] = 0;
+	for (int i = 0; i < NumVertices; i++)
+	{
+		const PCGExMesh::FVertex& Vtx = Mesh->Vertices[i];
+		PointIndices[i] = Vtx.PointIndex;
+		Adjacency.Append(Vtx.Neighbors);
+		AdjacencyOffsets[i + 1] = Adjacency.Num();
+		InvDegrees[i] = Vtx.Neighbors.IsEmpty() ? 0 : 1.0 / Vtx.Neighbors.Num();
+	}
+
+	X.SetNumUninitialized(NumVertices);
+	Y.SetNumUninitialized(NumVertices);
+	Z.SetNumUninitialized(NumVertices);
+	NextX.SetNumUninitialized(NumVertices);
+	NextY.SetNumUninitialized(NumVertices);
+	NextZ.SetNumUninitialized(NumVertices);
+
+	bLoadPositions = true;
+}
+
+void UPCGExLaplacianRelaxing::PrepareForIteration(const int Iteration, TArray<FVector>* PrimaryBuffer, TArray<FVector>* SecondaryBuffer)
+{
+	Super::PrepareForIteration(Iteration, PrimaryBuffer, SecondaryBuffer);
+
+	if (!bLoadPositions) { return; }
+	bLoadPositions = false;
+
+	// Positions are kept as SoA for the duration of the mesh, buffers are only written to
+
+	const TArray<FVector>& Positions = *ReadBuffer;
+	for (int i = 0; i < PointIndices.Num(); i++)
+	{
+		const FVector& Position = Positions[PointIndices[i]];
+		X[i] = Position.X;
+		Y[i] = Position.Y;
+		Z[i] = Position.Z;
+	}
+}
+
+void UPCGExLaplacianRelaxing::ProcessIteration(const bool bParallel)
+{
+	const int32 NumVertices = PointIndices.Num();
+	if (NumVertices == 0) { return; }
+
+	const double Factor = bTaubin && CurrentIteration % 2 == 1 ? Mu : Lambda;
+	const VectorRegister4Double FactorV = MakeVectorRegisterDouble(Factor, Factor, Factor, Factor);
+
+	// Chunks start on multiples of 4 so the blend runs on full registers
+	const int32 ChunkSize = Align(FMath::Max(Context ? Context->ChunkSize : 0, 64), 4);
+	const int32 NumChunks = FMath::DivideAndRoundUp(NumVertices, ChunkSize);
+
+	TArray<FVector>& OutPositions = *WriteBuffer;
+
+	ParallelFor(
+		NumChunks, [&](const int32 ChunkIndex)
+		{
+			const int32 Start = ChunkIndex * ChunkSize;
+			const int32 End = FMath::Min(Start + ChunkSize, NumVertices);
+
+			// Neighbors average
+
+			for (int i = Start; i < End; i++)
+			{
+				const int32 First = AdjacencyOffsets[i];
+				const int32 Last = AdjacencyOffsets[i + 1];
+
+				if (First == Last)
+				{
+					NextX[i] = X[i];
+					NextY[i] = Y[i];
+					NextZ[i] = Z[i];
+					continue;
+				}
+
+				double SumX = 0;
+				double SumY = 0;
+				double SumZ = 0;
+
+				for (int j = First; j < Last; j++)
+				{
+					const int32 Neighbor = Adjacency[j];
+					SumX += X[Neighbor];
+					SumY += Y[Neighbor];
+					SumZ += Z[Neighbor];
+				}
+
+				NextX[i] = SumX * InvDegrees[i];
+				NextY[i] = SumY * InvDegrees[i];
+				NextZ[i] = SumZ * InvDegrees[i];
+			}
+
+			// Next = Current + Factor * (Average - Current)
+
+			int32 Index = Start;
+			for (; Index + 4 <= End; Index += 4)
+			{
+				const VectorRegister4Double CurrentX = VectorLoad(X.GetData() + Index);
+				const VectorRegister4Double CurrentY = VectorLoad(Y.GetData() + Index);
+				const VectorRegister4Double CurrentZ = VectorLoad(Z.GetData() + Index);
+
+				VectorStore(VectorMultiplyAdd(FactorV, VectorSubtract(VectorLoad(NextX.GetData() + Index), CurrentX), CurrentX), NextX.GetData() + Index);
+				VectorStore(VectorMultiplyAdd(FactorV, VectorSubtract(VectorLoad(NextY.GetData() + Index), CurrentY), CurrentY), NextY.GetData() + Index);
+				VectorStore(VectorMultiplyAdd(FactorV, VectorSubtract(VectorLoad(NextZ.GetData() + Index), CurrentZ), CurrentZ), NextZ.GetData() + Index);
+			}
+
+			for (; Index < End; Index++)
+			{
+				NextX[Index] = X[Index] + Factor * (NextX[Index] - X[Index]);
+				NextY[Index] = Y[Index] + Factor * (NextY[Index] - Y[Index]);
+				NextZ[Index] = Z[Index] + Factor * (NextZ[Index] - Z[Index]);
+			}
+
+			for (int i = Start; i < End; i++) { OutPositions[PointIndices[i]] = FVector(NextX[i], NextY[i], NextZ[i]); }
+		}, !bParallel);
+
+	Swap(X, NextX);
+	Swap(Y, NextY);
+	Swap(Z, NextZ);
+}
+
+void UPCGExLaplacianRelaxing::Cleanup()
+{
+	PointIndices.Empty();
+	AdjacencyOffsets.Empty();
+	Adjacency.Empty();
+	InvDegrees.Empty();
+
+	X.Empty();
+	Y.Empty();
+	Z.Empty();
+	NextX.Empty();
+	NextY.Empty();
+	NextZ.Empty();
+
+	Super::Cleanup();
+}
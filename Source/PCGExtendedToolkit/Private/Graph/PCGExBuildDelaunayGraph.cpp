@@ -0,0 +1,138 @@
+﻿// Copyright Timothé Lapetite 2023
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Graph/PCGExBuildDelaunayGraph.h"
+
+#include "Geometry/PCGExGeoDelaunay.h"
+#include "Graph/PCGExGraph.h"
+
+#define LOCTEXT_NAMESPACE "PCGExGraph"
+#define PCGEX_NAMESPACE BuildDelaunayGraph
+
+FPCGExBuildDelaunayGraphContext::~FPCGExBuildDelaunayGraphContext()
+{
+	PCGEX_TERMINATE_ASYNC
+
+	NumSkippedSites.Empty();
+}
+
+PCGEX_INITIALIZE_ELEMENT(BuildDelaunayGraph)
+
+bool FPCGExBuildDelaunayGraphElement::Boot(FPCGContext* InContext) const
+{
+	if (!FPCGExEdgesBuilderElement::Boot(InContext)) { return false; }
+
+	PCGEX_CONTEXT_AND_SETTINGS(BuildDelaunayGraph)
+
+	PCGEX_FWD(b3D)
+	PCGEX_FWD(GraphType)
+
+	Context->ProjectionNormal = Settings->ProjectionNormal.GetSafeNormal(1E-08, FVector::UpVector);
+	Context->NumSkippedSites.Init(0, Context->MainPoints->Num());
+
+	return true;
+}
+
+void FPCGExBuildDelaunayGraphElement::StartBuildTask(FPCGExEdgesBuilderContext* InContext, PCGExData::FPointIO& PointIO, const int32 Index) const
+{
+	InContext->GetAsyncManager()->Start<FPCGExDelaunayGraphTask>(Index, &PointIO);
+}
+
+void FPCGExBuildDelaunayGraphElement::OnBuildComplete(FPCGExEdgesBuilderContext* InContext) const
+{
+	PCGEX_CONTEXT(BuildDelaunayGraph)
+
+	int32 NumSkippedSites = 0;
+	for (const int32 NumSkipped : Context->NumSkippedSites) { NumSkippedSites += NumSkipped; }
+	if (NumSkippedSites > 0)
+	{
+		PCGE_LOG(Warning, GraphAndLog, FText::Format(FTEXT("{0} point(s) could not be inserted in the 3D triangulation and have no edges."), NumSkippedSites));
+	}
+}
+
+bool FPCGExDelaunayGraphTask::ExecuteTask()
+{
+	FPCGExBuildDelaunayGraphContext* Context = static_cast<FPCGExBuildDelaunayGraphContext*>(Manager->Context);
+
+	const TArray<FPCGPoint>& Points = PointIO->GetOut()->GetPoints();
+	const int32 NumPoints = Points.Num();
+
+	TArray<FVector> Positions;
+	Positions.SetNumUninitialized(NumPoints);
+	for (int i = 0; i < NumPoints; i++) { Positions[i] = Points[i].Transform.GetLocation(); }
+
+	TArray<PCGExGraph::FUnsignedEdge> Edges;
+	TArray<FIntVector> Triangles;
+	bool bTriangulated = false;
+
+	if (Context->b3D)
+	{
+		PCGExGeo::FDelaunay3 Delaunay;
+		if (Delaunay.Process(Positions))
+		{
+			bTriangulated = true;
+			Context->NumSkippedSites[TaskIndex] = Delaunay.NumSkippedSites; // Each task owns its slot
+			Edges = MoveTemp(Delaunay.Edges);
+
+			if (Context->GraphType == EPCGExDelaunayGraphType::Urquhart)
+			{
+				Triangles.Reserve(Delaunay.Tetrahedra.Num() * 4);
+				for (const FIntVector4& Tetrahedron : Delaunay.Tetrahedra)
+				{
+					Triangles.Emplace(Tetrahedron.X, Tetrahedron.Y, Tetrahedron.Z);
+					Triangles.Emplace(Tetrahedron.X, Tetrahedron.Y, Tetrahedron.W);
+					Triangles.Emplace(Tetrahedron.X, Tetrahedron.Z, Tetrahedron.W);
+					Triangles.Emplace(Tetrahedron.Y, Tetrahedron.Z, Tetrahedron.W);
+				}
+			}
+		}
+	}
+
+	if (!bTriangulated)
+	{
+		// Project points on the plane, pruning happens in projected space as well
+		const FQuat Projection = FQuat::FindBetweenNormals(Context->ProjectionNormal, FVector::UpVector);
+
+		TArray<FVector2D> Positions2D;
+		Positions2D.SetNumUninitialized(NumPoints);
+		for (int i = 0; i < NumPoints; i++)
+		{
+			FVector& Position = Positions[i];
+			Position = Projection.RotateVector(Position);
+			Position.Z = 0;
+			Positions2D[i] = FVector2D(Position.X, Position.Y);
+		}
+
+		PCGExGeo::FDelaunay2 Delaunay;
+		if (!Delaunay.Process(Positions2D)) { return false; }
+
+		Edges = MoveTemp(Delaunay.Edges);
+		Triangles = MoveTemp(Delaunay.Triangles);
+	}
+
+	PCGEX_ASYNC_CHECKPOINT
+
+	switch (Context->GraphType)
+	{
+	default:
+	case EPCGExDelaunayGraphType::Delaunay:
+		break;
+	case EPCGExDelaunayGraphType::Gabriel:
+		PCGExGeo::PruneGabriel(Positions, Edges, Context->bDoAsyncProcessing);
+		break;
+	case EPCGExDelaunayGraphType::RelativeNeighborhood:
+		PCGExGeo::PruneRelativeNeighborhood(Positions, Edges, Context->bDoAsyncProcessing);
+		break;
+	case EPCGExDelaunayGraphType::Urquhart:
+		PCGExGeo::PruneUrquhart(Positions, Triangles, Edges);
+		break;
+	}
+
+	PCGEX_ASYNC_CHECKPOINT
+
+	Context->WriteIslands(TaskIndex, *PointIO, Edges);
+	return true;
+}
+
+#undef LOCTEXT_NAMESPACE
+#undef PCGEX_NAMESPACE
@@ -86,12 +86,9 @@ bool FPCGExBuildGraphElement::ExecuteInternal(
 			Context->PrepareCurrentGraphForPoints(PointIO, false);
 		};
 
-		auto ProcessPoint = [&](const int32 PointIndex, const PCGExData::FPointIO& PointIO)
-		{
-			Context->GetAsyncManager()->Start<FProbeTask>(PointIndex, Context->CurrentIO);
-		};
-
-		if (Context->ProcessCurrentPoints(Initialize, ProcessPoint)) { Context->SetAsyncState(PCGExMT::State_WaitingOnAsyncWork); }
+		Initialize(*Context->CurrentIO);
+		Context->GetAsyncManager()->StartRanges<FProbeTask>(Context->CurrentIO->GetNum(), Context->ChunkSize, Context->CurrentIO);
+		Context->SetAsyncState(PCGExMT::State_WaitingOnAsyncWork);
 	}
 
 	if (Context->IsState(PCGExMT::State_WaitingOnAsyncWork))
@@ -102,12 +99,14 @@ bool FPCGExBuildGraphElement::ExecuteInternal(
 	if (Context->IsState(PCGExGraph::State_FindingEdgeTypes))
 	{
 		// Process params again for edges types
+		auto Initialize = [&](const PCGExData::FPointIO& PointIO) { Context->PrepareEdgeTypes(PointIO); };
+
 		auto ProcessPointEdgeType = [&](const int32 PointIndex, const PCGExData::FPointIO& PointIO)
 		{
-			ComputeEdgeType(Context->SocketInfos, PointIndex);
+			Context->ComputeEdgeType(PointIndex);
 		};
 
-		if (Context->ProcessCurrentPoints(ProcessPointEdgeType))
+		if (Context->ProcessCurrentPoints(Initialize, ProcessPointEdgeType))
 		{
 			for (const PCGExGraph::FSocketInfos& SocketInfos : Context->SocketInfos) { SocketInfos.Socket->Write(); }
 			Context->SetState(PCGExGraph::State_ReadyForNextGraph);
@@ -0,0 +1,73 @@
+﻿// Copyright Timothé Lapetite 2023
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Graph/PCGExBuildKNNGraph.h"
+
+#include "Async/ParallelFor.h"
+#include "Geometry/PCGExGeoKDTree.h"
+#include "Graph/PCGExGraph.h"
+
+#define LOCTEXT_NAMESPACE "PCGExGraph"
+#define PCGEX_NAMESPACE BuildKNNGraph
+
+PCGEX_INITIALIZE_ELEMENT(BuildKNNGraph)
+
+bool FPCGExBuildKNNGraphElement::Boot(FPCGContext* InContext) const
+{
+	if (!FPCGExEdgesBuilderElement::Boot(InContext)) { return false; }
+
+	PCGEX_CONTEXT_AND_SETTINGS(BuildKNNGraph)
+
+	Context->K = FMath::Max(1, Settings->K);
+	Context->MaxDistanceSquared = Settings->bUseMaxDistance ? FMath::Square(Settings->MaxDistance) : TNumericLimits<double>::Max();
+
+	return true;
+}
+
+void FPCGExBuildKNNGraphElement::StartBuildTask(FPCGExEdgesBuilderContext* InContext, PCGExData::FPointIO& PointIO, const int32 Index) const
+{
+	InContext->GetAsyncManager()->Start<FPCGExKNNGraphTask>(Index, &PointIO);
+}
+
+bool FPCGExKNNGraphTask::ExecuteTask()
+{
+	FPCGExBuildKNNGraphContext* Context = static_cast<FPCGExBuildKNNGraphContext*>(Manager->Context);
+
+	const TArray<FPCGPoint>& Points = PointIO->GetOut()->GetPoints();
+	const int32 NumPoints = Points.Num();
+	const int32 K = FMath::Min(Context->K, NumPoints - 1);
+	const double MaxDistanceSquared = Context->MaxDistanceSquared;
+
+	TArray<FVector> Positions;
+	Positions.SetNumUninitialized(NumPoints);
+	for (int i = 0; i < NumPoints; i++) { Positions[i] = Points[i].Transform.GetLocation(); }
+
+	PCGExGeo::FKDTree Tree;
+	Tree.Build(Positions);
+
+	PCGEX_ASYNC_CHECKPOINT
+
+	PCGExGraph::FEdgeSet UniqueEdges;
+	UniqueEdges.Reset(NumPoints * K / 2 + 1); // Most neighborhoods are mutual
+
+	ParallelFor(
+		NumPoints, [&](const int32 Index)
+		{
+			TArray<int32> Neighbors;
+			Tree.FindNearest(Positions[Index], K, MaxDistanceSquared, Neighbors, Index);
+			for (const int32 Neighbor : Neighbors) { UniqueEdges.Add(PCGExGraph::FUnsignedEdge(Index, Neighbor, EPCGExEdgeType::Complete)); }
+		}, !Context->bDoAsyncProcessing);
+
+	PCGEX_ASYNC_CHECKPOINT
+
+	TArray<PCGExGraph::FUnsignedEdge> Edges;
+	UniqueEdges.Gather(Edges);
+	UniqueEdges.Reset();
+
+	// Neighborhoods don't guarantee connectivity, distant groups of points end up in separate islands
+	Context->WriteIslands(TaskIndex, *PointIO, Edges);
+	return true;
+}
+
+#undef LOCTEXT_NAMESPACE
+#undef PCGEX_NAMESPACE
@@ -60,18 +60,20 @@ bool FPCGExConsolidateGraphElement::ExecuteInternal(
 	{
 		auto Initialize = [&](const PCGExData::FPointIO& PointIO)
 		{
-			Context->IndicesRemap.Empty(PointIO.GetNum());
-			//PointIO.GetInKeys();
-			//PointIO.GetOutKeys();
 			Context->PrepareCurrentGraphForPoints(PointIO, false); // Prepare to read PointIO->Out
+
+			// Previous indices are bounded by the largest cached one
+			int32 MaxCachedIndex = -1;
+			for (int i = 0; i < PointIO.GetNum(); i++) { MaxCachedIndex = FMath::Max(MaxCachedIndex, Context->GetCachedIndex(i)); }
+			Context->IndicesRemap.Init(-1, MaxCachedIndex + 1);
 		};
 
 		auto ProcessPoint = [&](const int32 PointIndex, const PCGExData::FPointIO& PointIO)
 		{
-			FWriteScopeLock WriteLock(Context->IndicesLock);
+			// Each surviving point owns a unique previous index, so this scatter is lock-free
 			const int32 CachedIndex = Context->GetCachedIndex(PointIndex);
-			Context->IndicesRemap.Add(CachedIndex, PointIndex); // Store previous
-			Context->SetCachedIndex(PointIndex, PointIndex);    // Update cached value with fresh one
+			if (CachedIndex >= 0) { Context->IndicesRemap[CachedIndex] = PointIndex; } // Store previous
+			Context->SetCachedIndex(PointIndex, PointIndex);                              // Update cached value with fresh one
 		};
 
 		if (Context->ProcessCurrentPoints(Initialize, ProcessPoint))
@@ -86,14 +88,13 @@ bool FPCGExConsolidateGraphElement::ExecuteInternal(
 	{
 		auto ConsolidatePoint = [&](const int32 PointIndex, const PCGExData::FPointIO& PointIO)
 		{
-			FReadScopeLock ReadLock(Context->IndicesLock);
 			for (const PCGExGraph::FSocketInfos& SocketInfos : Context->SocketInfos)
 			{
 				const int32 OldRelationIndex = SocketInfos.Socket->GetTargetIndex(PointIndex);
 
 				if (OldRelationIndex == -1) { continue; } // No need to fix further
 
-				const int32 NewRelationIndex = GetFixedIndex(Context, OldRelationIndex);
+				const int32 NewRelationIndex = Context->GetFixedIndex(OldRelationIndex);
 
 				if (NewRelationIndex == -1) { SocketInfos.Socket->SetEdgeType(PointIndex, EPCGExEdgeType::Unknown); }
 
@@ -111,12 +112,14 @@ bool FPCGExConsolidateGraphElement::ExecuteInternal(
 
 	if (Context->IsState(PCGExGraph::State_FindingEdgeTypes))
 	{
+		auto Initialize = [&](const PCGExData::FPointIO& PointIO) { Context->PrepareEdgeTypes(PointIO); };
+
 		auto ConsolidateEdgesType = [&](const int32 PointIndex, const PCGExData::FPointIO& PointIO)
 		{
-			ComputeEdgeType(Context->SocketInfos, PointIndex);
+			Context->ComputeEdgeType(PointIndex);
 		};
 
-		if (Context->ProcessCurrentPoints(ConsolidateEdgesType))
+		if (Context->ProcessCurrentPoints(Initialize, ConsolidateEdgesType))
 		{
 			Context->SetState(PCGExMT::State_ReadyForNextPoints);
 		}
@@ -133,11 +136,5 @@ bool FPCGExConsolidateGraphElement::ExecuteInternal(
 	return Context->IsDone();
 }
 
-int64 FPCGExConsolidateGraphElement::GetFixedIndex(FPCGExConsolidateGraphContext* Context, const int64 InIndex)
-{
-	if (const int64* FixedRelationIndexPtr = Context->IndicesRemap.Find(InIndex)) { return *FixedRelationIndexPtr; }
-	return -1;
-}
-
 #undef LOCTEXT_NAMESPACE
 #undef PCGEX_NAMESPACE
@@ -2,3 +2,50 @@
 // Released under the MIT license https://opensource.org/license/MIT/
 
 #include "Graph/PCGExEdge.h"
+
+namespace PCGExGraph
+{
+	void FEdgeSet::Reset(const int32 InNumEdgesReserve)
+	{
+		const int32 ShardReserve = InNumEdgesReserve / NumShards;
+		for (FShard& Shard : Shards)
+		{
+			FWriteScopeLock WriteLock(Shard.Lock);
+			Shard.Hashes.Reset();
+			Shard.Edges.Reset(ShardReserve);
+			if (ShardReserve > 0) { Shard.Hashes.Reserve(ShardReserve); }
+		}
+	}
+
+	bool FEdgeSet::Add(const FUnsignedEdge& Edge)
+	{
+		const uint64 Hash = Edge.GetUnsignedHash();
+		FShard& Shard = Shards[GetShardIndex(Hash)];
+
+		{
+			FReadScopeLock ReadLock(Shard.Lock);
+			if (Shard.Hashes.Contains(Hash)) { return false; }
+		}
+
+		FWriteScopeLock WriteLock(Shard.Lock);
+		bool bAlreadySet = false;
+		Shard.Hashes.Add(Hash, &bAlreadySet);
+		if (bAlreadySet) { return false; }
+		Shard.Edges.Add(Edge);
+		return true;
+	}
+
+	int32 FEdgeSet::Num() const
+	{
+		int32 Count = 0;
+		for (const FShard& Shard : Shards) { Count += Shard.Edges.Num(); }
+		return Count;
+	}
+
+	void FEdgeSet::Gather(TArray<FUnsignedEdge>& OutEdges) const
+	{
+		OutEdges.Reset(Num());
+		for (const FShard& Shard : Shards) { OutEdges.Append(Shard.Edges); }
+		OutEdges.Sort([](const FUnsignedEdge& A, const FUnsignedEdge& B) { return A.GetUnsignedHash() < B.GetUnsignedHash(); });
+	}
+}
@@ -0,0 +1,157 @@
+﻿// Copyright Timothé Lapetite 2023
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Graph/PCGExEdgesBuilder.h"
+
+#include "Data/PCGExClusterData.h"
+#include "Graph/PCGExGraph.h"
+
+#define LOCTEXT_NAMESPACE "PCGExGraph"
+#define PCGEX_NAMESPACE EdgesBuilder
+
+TArray<FPCGPinProperties> UPCGExEdgesBuilderSettings::OutputPinProperties() const
+{
+	TArray<FPCGPinProperties> PinProperties = Super::OutputPinProperties();
+	FPCGPinProperties& PinEdgesOutput = PinProperties.Emplace_GetRef(PCGExGraph::OutputEdgesLabel, EPCGDataType::Point);
+
+#if WITH_EDITOR
+	PinEdgesOutput.Tooltip = FTEXT("Point data representing edges.");
+#endif // WITH_EDITOR
+
+	return PinProperties;
+}
+
+FName UPCGExEdgesBuilderSettings::GetMainOutputLabel() const { return PCGExGraph::OutputVerticesLabel; }
+
+PCGExData::EInit UPCGExEdgesBuilderSettings::GetMainOutputInitMode() const { return PCGExData::EInit::DuplicateInput; }
+
+FPCGExEdgesBuilderContext::~FPCGExEdgesBuilderContext()
+{
+	PCGEX_TERMINATE_ASYNC
+
+	Markings.Empty();
+	PCGEX_DELETE(EdgesIO)
+}
+
+void FPCGExEdgesBuilderContext::WriteIslands(const int32 InputIndex, const PCGExData::FPointIO& PointIO, const TArray<PCGExGraph::FUnsignedEdge>& Edges)
+{
+	const TArray<FPCGPoint>& Vertices = PointIO.GetOut()->GetPoints();
+	const int32 NumVertices = Vertices.Num();
+
+	// Union-find over vertices, each root ends up owning an island
+
+	TArray<int32> Parents;
+	Parents.SetNumUninitialized(NumVertices);
+	for (int i = 0; i < NumVertices; i++) { Parents[i] = i; }
+
+	auto FindRoot = [&](int32 Index)
+	{
+		while (Parents[Index] != Index) { Index = Parents[Index] = Parents[Parents[Index]]; }
+		return Index;
+	};
+
+	for (const PCGExGraph::FUnsignedEdge& Edge : Edges)
+	{
+		const int32 A = FindRoot(Edge.Start);
+		const int32 B = FindRoot(Edge.End);
+		if (A != B) { Parents[FMath::Max(A, B)] = FMath::Min(A, B); }
+	}
+
+	// Islands are ordered by their first edge, which keeps outputs deterministic
+
+	TArray<int32> RootIslands;
+	RootIslands.Init(-1, NumVertices);
+	TArray<TArray<PCGExGraph::FUnsignedEdge>> Islands;
+
+	for (const PCGExGraph::FUnsignedEdge& Edge : Edges)
+	{
+		int32& Island = RootIslands[FindRoot(Edge.Start)];
+		if (Island == -1)
+		{
+			Island = Islands.Num();
+			Islands.Emplace();
+		}
+		Islands[Island].Add(Edge);
+	}
+
+	PCGExData::FKPointIOMarkedBindings<int32>& Marking = Markings[InputIndex];
+
+	for (int i = 0; i < Islands.Num(); i++)
+	{
+		PCGExData::FPointIO& IslandIO = EdgesIO->Emplace_GetRef(PCGExData::EInit::NoOutput);
+		IslandIO.InitializeOutput<UPCGExClusterEdgesData>(PCGExData::EInit::NewOutput);
+		Marking.Add(IslandIO);
+
+		PCGExGraph::WriteEdges(IslandIO, Vertices, Islands[i], i);
+	}
+}
+
+bool FPCGExEdgesBuilderElement::Boot(FPCGContext* InContext) const
+{
+	if (!FPCGExPointsProcessorElementBase::Boot(InContext)) { return false; }
+
+	PCGEX_CONTEXT(EdgesBuilder)
+
+	Context->EdgesIO = new PCGExData::FPointIOGroup();
+	Context->EdgesIO->DefaultOutputLabel = PCGExGraph::OutputEdgesLabel;
+
+	return true;
+}
+
+bool FPCGExEdgesBuilderElement::ExecuteInternal(FPCGContext* InContext) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FPCGExEdgesBuilderElement::Execute);
+
+	PCGEX_CONTEXT(EdgesBuilder)
+
+	if (Context->IsSetup())
+	{
+		if (!Boot(Context)) { return true; }
+		Context->SetState(PCGExMT::State_ReadyForNextPoints);
+	}
+
+	if (Context->IsState(PCGExMT::State_ReadyForNextPoints))
+	{
+		// Markings must all exist before any task starts writing islands to them
+		Context->Markings.Reserve(Context->MainPoints->Num());
+		Context->MainPoints->ForEach(
+			[&](PCGExData::FPointIO& PointIO, const int32)
+			{
+				PCGExData::FKPointIOMarkedBindings<int32>& Marking = Context->Markings.Emplace_GetRef(&PointIO, PCGExGraph::PUIDAttributeName);
+				Marking.Mark = PointIO.GetIn()->GetUniqueID();
+			});
+
+		Context->MainPoints->ForEach(
+			[&](PCGExData::FPointIO& PointIO, const int32 Index)
+			{
+				if (PointIO.GetNum() < 2) { return; }
+				StartBuildTask(Context, PointIO, Index);
+			});
+
+		Context->SetAsyncState(PCGExMT::State_WaitingOnAsyncWork);
+	}
+
+	if (Context->IsState(PCGExMT::State_WaitingOnAsyncWork))
+	{
+		if (Context->IsAsyncWorkComplete())
+		{
+			OnBuildComplete(Context);
+
+			for (PCGExData::FKPointIOMarkedBindings<int32>& Marking : Context->Markings) { Marking.UpdateMark(); }
+			Context->OutputPoints();
+
+			// Output islands in input order, rather than in the order tasks created them
+			for (const PCGExData::FKPointIOMarkedBindings<int32>& Marking : Context->Markings)
+			{
+				for (PCGExData::FPointIO* IslandIO : Marking.Values) { IslandIO->OutputTo(Context, true); }
+			}
+
+			Context->Done();
+		}
+	}
+
+	return Context->IsDone();
+}
+
+#undef LOCTEXT_NAMESPACE
+#undef PCGEX_NAMESPACE
@@ -89,9 +89,9 @@ bool FPCGExEdgesProcessorContext::AdvanceEdges()
 
 	if (CurrentEdges) { CurrentEdges->Cleanup(); }
 
-	if (Edges->Pairs.IsValidIndex(++CurrentEdgesIndex))
+	if (BoundEdges && BoundEdges->Values.IsValidIndex(++CurrentEdgesIndex))
 	{
-		CurrentEdges = Edges->Pairs[CurrentEdgesIndex];
+		CurrentEdges = BoundEdges->Values[CurrentEdgesIndex];
 
 		CurrentMesh = new PCGExMesh::FMesh();
 		CurrentIO->CreateInKeys();
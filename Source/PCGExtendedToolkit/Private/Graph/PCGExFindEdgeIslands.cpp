@@ -3,6 +3,7 @@
 
 #include "Graph/PCGExFindEdgeIslands.h"
 
+#include "Data/PCGExClusterData.h"
 #include "Data/PCGExData.h"
 #include "Elements/Metadata/PCGMetadataElementCommon.h"
 
@@ -142,8 +143,8 @@ bool FPCGExFindEdgeIslandsElement::ExecuteInternal(
 
 					for (const PCGExGraph::FSocketInfos& SocketInfo : Context->SocketInfos)
 					{
-						const int32 End = SocketInfo.Socket->GetTargetIndexReader().Values[Index];
-						const int32 InEdgeType = SocketInfo.Socket->GetEdgeTypeReader().Values[Index];
+						const int32 End = SocketInfo.Socket->GetTargetIndexReader()[Index];
+						const int32 InEdgeType = SocketInfo.Socket->GetEdgeTypeReader()[Index];
 
 						if (End != -1 && (InEdgeType & EdgeType) != 0)
 						{
@@ -237,7 +238,8 @@ bool FPCGExFindEdgeIslandsElement::ExecuteInternal(
 			const int32 IslandSize = Pair.Value;
 			if (IslandSize == -1) { continue; }
 
-			PCGExData::FPointIO& IslandIO = Context->IslandsIO->Emplace_GetRef(PCGExData::EInit::NewOutput);
+			PCGExData::FPointIO& IslandIO = Context->IslandsIO->Emplace_GetRef(PCGExData::EInit::NoOutput);
+			IslandIO.InitializeOutput<UPCGExClusterEdgesData>(PCGExData::EInit::NewOutput);
 			Context->Markings->Add(IslandIO);
 
 			Context->GetAsyncManager()->Start<FWriteIslandTask>(
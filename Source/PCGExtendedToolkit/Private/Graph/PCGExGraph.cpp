@@ -3,6 +3,8 @@
 
 #include "Graph/PCGExGraph.h"
 
+#include "Data/PCGExClusterData.h"
+
 namespace PCGExGraph
 {
 	FSocket::~FSocket()
@@ -188,6 +190,40 @@ namespace PCGExGraph
 		}
 	}
 
+	void FSocketMapping::PackTargetIndices(const int32 NumPoints, TArray<int32>& OutPackedTargets) const
+	{
+		OutPackedTargets.SetNumUninitialized(NumPoints * NumSockets);
+		int32* Packed = OutPackedTargets.GetData();
+
+		for (int s = 0; s < NumSockets; s++)
+		{
+			const int32* Targets = Sockets[s].GetTargetIndices().GetData();
+			for (int i = 0; i < NumPoints; i++) { Packed[i * NumSockets + s] = Targets[i]; }
+		}
+	}
+
+	void FSocketMapping::ComputeEdgeType(const TArray<int32>& PackedTargets, const int32 PointIndex) const
+	{
+		const int32* Packed = PackedTargets.GetData();
+		const int32* PointTargets = Packed + PointIndex * NumSockets;
+
+		for (int s = 0; s < NumSockets; s++)
+		{
+			EPCGExEdgeType Type = EPCGExEdgeType::Unknown;
+
+			if (const int32 RelationIndex = PointTargets[s]; RelationIndex != -1)
+			{
+				const int32* OtherTargets = Packed + RelationIndex * NumSockets;
+				const EPCGExEdgeType* TypeRow = EdgeTypeTable.GetData() + s * NumSockets;
+
+				Type = EPCGExEdgeType::Roaming;
+				for (int o = 0; o < NumSockets; o++) { Type = OtherTargets[o] == PointIndex ? TypeRow[o] : Type; }
+			}
+
+			Sockets[s].SetEdgeType(PointIndex, Type);
+		}
+	}
+
 	void FSocketMapping::Cleanup()
 	{
 		for (FSocket& Socket : Sockets) { Socket.Cleanup(); }
@@ -197,6 +233,7 @@ namespace PCGExGraph
 
 	void FSocketMapping::Reset()
 	{
+		EdgeTypeTable.Empty();
 		Sockets.Empty();
 		Modifiers.Empty();
 		LocalDirections.Empty();
@@ -216,6 +253,19 @@ namespace PCGExGraph
 				}
 			}
 		}
+
+		// Same logic as PCGExGraph::GetEdgeType, resolved once per socket pair
+		EdgeTypeTable.SetNumUninitialized(NumSockets * NumSockets);
+		for (const FSocket& Start : Sockets)
+		{
+			for (const FSocket& End : Sockets)
+			{
+				EPCGExEdgeType& Type = EdgeTypeTable[Start.SocketIndex * NumSockets + End.SocketIndex];
+				if (Start.Matches(&End)) { Type = End.Matches(&Start) ? EPCGExEdgeType::Complete : EPCGExEdgeType::Match; }
+				else if (Start.SocketIndex == End.SocketIndex) { Type = EPCGExEdgeType::Mirror; }
+				else { Type = EPCGExEdgeType::Shared; }
+			}
+		}
 	}
 
 	bool FNetworkNode::GetNeighbors(TArray<int32>& OutIndices, const TArray<FUnsignedEdge>& InEdges)
@@ -377,6 +427,47 @@ namespace PCGExGraph
 			EdgeNetwork->InsertEdge(FUnsignedEdge(NewNode.Index, Edges[EdgeCrossing.EdgeB].End, EPCGExEdgeType::Complete));
 		}
 	}
+
+	void WriteEdges(PCGExData::FPointIO& EdgesIO, const TArray<FPCGPoint>& Vertices, const TArray<FUnsignedEdge>& Edges, const int32 IslandID)
+	{
+		const int32 NumEdges = Edges.Num();
+
+		TArray<FPCGPoint>& MutablePoints = EdgesIO.GetOut()->GetMutablePoints();
+		MutablePoints.SetNum(NumEdges);
+
+		EdgesIO.CreateOutKeys();
+
+		PCGEx::TFAttributeWriter<int32>* EdgeStart = new PCGEx::TFAttributeWriter<int32>(EdgeStartAttributeName, -1, false);
+		PCGEx::TFAttributeWriter<int32>* EdgeEnd = new PCGEx::TFAttributeWriter<int32>(EdgeEndAttributeName, -1, false);
+
+		EdgeStart->BindAndGet(EdgesIO);
+		EdgeEnd->BindAndGet(EdgesIO);
+
+		for (int i = 0; i < NumEdges; i++)
+		{
+			const FUnsignedEdge& Edge = Edges[i];
+			MutablePoints[i].Transform.SetLocation(
+				FMath::Lerp(
+					Vertices[(EdgeStart->Values[i] = Edge.Start)].Transform.GetLocation(),
+					Vertices[(EdgeEnd->Values[i] = Edge.End)].Transform.GetLocation(), 0.5));
+		}
+
+		if (UPCGExClusterEdgesData* ClusterData = Cast<UPCGExClusterEdgesData>(EdgesIO.GetOut()))
+		{
+			const TSharedPtr<PCGExMesh::FClusterTopology> Topology = MakeShared<PCGExMesh::FClusterTopology>();
+			Topology->IslandID = IslandID;
+			Topology->EdgeStart = EdgeStart->Values;
+			Topology->EdgeEnd = EdgeEnd->Values;
+			Topology->Build(Vertices.Num());
+			ClusterData->SetTopology(Topology);
+		}
+
+		EdgeStart->Write();
+		EdgeEnd->Write();
+
+		PCGEX_DELETE(EdgeStart)
+		PCGEX_DELETE(EdgeEnd)
+	}
 }
 
 bool FWriteIslandTask::ExecuteTask()
@@ -404,54 +495,18 @@ bool FWriteIslandTask::ExecuteTask()
 	IslandSize = IslandSet.Num();
 	IslandSet.Empty();
 
-	TArray<FPCGPoint>& MutablePoints = IslandIO->GetOut()->GetMutablePoints();
-	MutablePoints.SetNum(IslandSize);
-
-	IslandIO->CreateOutKeys();
-
-	PCGEx::TFAttributeWriter<int32>* EdgeStart = new PCGEx::TFAttributeWriter<int32>(PCGExGraph::EdgeStartAttributeName, -1, false);
-	PCGEx::TFAttributeWriter<int32>* EdgeEnd = new PCGEx::TFAttributeWriter<int32>(PCGExGraph::EdgeEndAttributeName, -1, false);
+	TArray<PCGExGraph::FUnsignedEdge> IslandEdges;
+	IslandEdges.Reserve(IslandSize);
 
-	EdgeStart->BindAndGet(*IslandIO);
-	EdgeEnd->BindAndGet(*IslandIO);
-
-	int32 PointIndex = 0;
 	int32 EdgeIndex;
-
-	const TArray<FPCGPoint> Vertices = PointIO->GetOut()->GetPoints();
-
-	if (IndexRemap)
+	while (Island.Dequeue(EdgeIndex))
 	{
-		while (Island.Dequeue(EdgeIndex))
-		{
-			const PCGExGraph::FUnsignedEdge& Edge = EdgeNetwork->Edges[EdgeIndex];
-			MutablePoints[PointIndex].Transform.SetLocation(
-				FMath::Lerp(
-					Vertices[(EdgeStart->Values[PointIndex] = *IndexRemap->Find(Edge.Start))].Transform.GetLocation(),
-					Vertices[(EdgeEnd->Values[PointIndex] = *IndexRemap->Find(Edge.End))].Transform.GetLocation(), 0.5));
-			PointIndex++;
-		}
+		const PCGExGraph::FUnsignedEdge& Edge = EdgeNetwork->Edges[EdgeIndex];
+		if (IndexRemap) { IslandEdges.Emplace(*IndexRemap->Find(Edge.Start), *IndexRemap->Find(Edge.End), Edge.Type); }
+		else { IslandEdges.Add(Edge); }
 	}
-	else
-	{
-		while (Island.Dequeue(EdgeIndex))
-		{
-			const PCGExGraph::FUnsignedEdge& Edge = EdgeNetwork->Edges[EdgeIndex];
-			MutablePoints[PointIndex].Transform.SetLocation(
-				FMath::Lerp(
-					Vertices[(EdgeStart->Values[PointIndex] = Edge.Start)].Transform.GetLocation(),
-					Vertices[(EdgeEnd->Values[PointIndex] = Edge.End)].Transform.GetLocation(), 0.5));
-			PointIndex++;
-		}
-	}
-
-
-	EdgeStart->Write();
-	EdgeEnd->Write();
 
-	//IslandData->Cleanup();
-	PCGEX_DELETE(EdgeStart)
-	PCGEX_DELETE(EdgeEnd)
+	PCGExGraph::WriteEdges(*IslandIO, PointIO->GetOut()->GetPoints(), IslandEdges, IslandUID);
 
 	return true;
 }
@@ -46,6 +46,7 @@ FPCGExGraphProcessorContext::~FPCGExGraphProcessorContext()
 	PCGEX_DELETE(CachedIndexWriter)
 
 	SocketInfos.Empty();
+	PackedTargetIndices.Empty();
 
 	if (CurrentGraph) { CurrentGraph->Cleanup(); }
 }
@@ -57,6 +58,7 @@ bool FPCGExGraphProcessorContext::AdvanceGraph(const bool bResetPointsIndex)
 	if (bResetPointsIndex) { CurrentPointsIndex = -1; }
 
 	if (CurrentGraph) { CurrentGraph->Cleanup(); }
+	PackedTargetIndices.Reset();
 
 	if (Graphs.Params.IsValidIndex(++CurrentParamsIndex))
 	{
@@ -112,6 +114,17 @@ void FPCGExGraphProcessorContext::PrepareCurrentGraphForPoints(const PCGExData::
 	CurrentGraph->PrepareForPointData(PointIO, bReadOnly);
 }
 
+void FPCGExGraphProcessorContext::PrepareEdgeTypes(const PCGExData::FPointIO& PointIO)
+{
+	check(!bReadOnly)
+	CurrentGraph->GetSocketMapping()->PackTargetIndices(PointIO.GetNum(), PackedTargetIndices);
+}
+
+void FPCGExGraphProcessorContext::ComputeEdgeType(const int32 PointIndex) const
+{
+	CurrentGraph->GetSocketMapping()->ComputeEdgeType(PackedTargetIndices, PointIndex);
+}
+
 PCGEX_INITIALIZE_CONTEXT(GraphProcessor)
 
 bool FPCGExGraphProcessorElement::Boot(FPCGContext* InContext) const
@@ -4,9 +4,111 @@
 #include "Graph/PCGExMesh.h"
 
 #include "Data/PCGExAttributeHelpers.h"
+#include "Data/PCGExClusterData.h"
 
 namespace PCGExMesh
 {
+	void FClusterTopology::Build(const int32 InNumVertexPoints)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FPCGExMesh::BuildTopology);
+
+		NumVertexPoints = InNumVertexPoints;
+		bHasInvalidEdges = false;
+
+		const int32 NumEdgePoints = EdgeStart.Num();
+
+		TArray<int32> PointToVertex;
+		PointToVertex.Init(-1, NumVertexPoints);
+
+		TArray<int32> Degrees;
+		Degrees.Reserve(NumVertexPoints);
+		VertexPointIndices.Reset(NumVertexPoints);
+
+		auto GetOrAddVertex = [&](const int32 PointIndex)
+		{
+			int32& VertexIndex = PointToVertex[PointIndex];
+			if (VertexIndex == -1)
+			{
+				VertexIndex = VertexPointIndices.Add(PointIndex);
+				Degrees.Add(0);
+			}
+			return VertexIndex;
+		};
+
+		// Assign vertices in order of appearance & count degrees
+
+		for (int i = 0; i < NumEdgePoints; i++)
+		{
+			if (!IsValidEdge(i))
+			{
+				bHasInvalidEdges = true;
+				continue;
+			}
+
+			Degrees[GetOrAddVertex(EdgeStart[i])]++;
+			Degrees[GetOrAddVertex(EdgeEnd[i])]++;
+		}
+
+		const int32 NumVtx = VertexPointIndices.Num();
+
+		TArray<int32> Cursors;
+		Cursors.SetNumUninitialized(NumVtx + 1);
+		Cursors[0] = 0;
+		for (int i = 0; i < NumVtx; i++) { Cursors[i + 1] = Cursors[i] + Degrees[i]; }
+
+		NeighborOffsets = Cursors;
+		Neighbors.SetNumUninitialized(Cursors[NumVtx]);
+		Edges.SetNumUninitialized(Cursors[NumVtx]);
+
+		for (int i = 0; i < NumEdgePoints; i++)
+		{
+			if (!IsValidEdge(i)) { continue; }
+
+			const int32 A = PointToVertex[EdgeStart[i]];
+			const int32 B = PointToVertex[EdgeEnd[i]];
+
+			Neighbors[Cursors[A]] = B;
+			Edges[Cursors[A]++] = i;
+			Neighbors[Cursors[B]] = A;
+			Edges[Cursors[B]++] = i;
+		}
+
+		// Compact ranges in-place, dropping duplicate neighbors (parallel edges) & edges (self-loops)
+
+		EdgeOffsets.SetNumUninitialized(NumVtx + 1);
+
+		int32 NeighborWrite = 0;
+		int32 EdgeWrite = 0;
+
+		for (int i = 0; i < NumVtx; i++)
+		{
+			const int32 RangeStart = NeighborOffsets[i];
+			const int32 RangeEnd = NeighborOffsets[i + 1];
+
+			NeighborOffsets[i] = NeighborWrite;
+			EdgeOffsets[i] = EdgeWrite;
+
+			for (int j = RangeStart; j < RangeEnd; j++)
+			{
+				const int32 Neighbor = Neighbors[j];
+				bool bFound = false;
+				for (int k = NeighborOffsets[i]; k < NeighborWrite; k++) { if (Neighbors[k] == Neighbor) { bFound = true; break; } }
+				if (!bFound) { Neighbors[NeighborWrite++] = Neighbor; }
+
+				const int32 Edge = Edges[j];
+				bFound = false;
+				for (int k = EdgeOffsets[i]; k < EdgeWrite; k++) { if (Edges[k] == Edge) { bFound = true; break; } }
+				if (!bFound) { Edges[EdgeWrite++] = Edge; }
+			}
+		}
+
+		NeighborOffsets[NumVtx] = NeighborWrite;
+		EdgeOffsets[NumVtx] = EdgeWrite;
+
+		Neighbors.SetNum(NeighborWrite);
+		Edges.SetNum(EdgeWrite);
+	}
+
 	FVertex::~FVertex()
 	{
 		Neighbors.Empty();
@@ -34,81 +136,81 @@ namespace PCGExMesh
 		Edges.Empty();
 	}
 
-	FVertex& FMesh::GetOrCreateVertex(const int32 PointIndex, bool& bJustCreated)
+	void FMesh::BuildFrom(const PCGExData::FPointIO& InPoints, const PCGExData::FPointIO& InEdges)
 	{
-		if (const int32* VertexIndex = IndicesMap.Find(PointIndex))
+		TRACE_CPUPROFILER_EVENT_SCOPE(FPCGExMesh::BuildMesh);
+
+		const int32 NumVertexPoints = InPoints.GetIn()->GetPoints().Num();
+		const int32 NumEdges = InEdges.GetIn()->GetPoints().Num();
+
+		if (const UPCGExClusterEdgesData* ClusterData = Cast<UPCGExClusterEdgesData>(InEdges.GetIn()))
 		{
-			bJustCreated = false;
-			return Vertices[*VertexIndex];
+			const TSharedPtr<const FClusterTopology> Topology = ClusterData->GetTopology();
+			if (Topology && Topology->IsCompatible(NumVertexPoints, NumEdges))
+			{
+				BuildFrom(*Topology, InPoints);
+				return;
+			}
 		}
 
-		bJustCreated = true;
-		FVertex& Vertex = Vertices.Emplace_GetRef();
-		const int32 VtxIndex = Vertices.Num() - 1;
-		IndicesMap.Add(PointIndex, VtxIndex);
+		// No usable topology, decode edge attributes
 
-		Vertex.PointIndex = PointIndex;
-		Vertex.MeshIndex = VtxIndex;
+		FClusterTopology Topology;
 
-		return Vertex;
+		PCGEx::TFAttributeReader<int32>* StartIndexReader = new PCGEx::TFAttributeReader<int32>(PCGExGraph::EdgeStartAttributeName);
+		PCGEx::TFAttributeReader<int32>* EndIndexReader = new PCGEx::TFAttributeReader<int32>(PCGExGraph::EdgeEndAttributeName);
+
+		if (StartIndexReader->Bind(const_cast<PCGExData::FPointIO&>(InEdges))) { Topology.EdgeStart = StartIndexReader->ConsumeValues(); }
+		else { Topology.EdgeStart.Init(-1, NumEdges); }
+
+		if (EndIndexReader->Bind(const_cast<PCGExData::FPointIO&>(InEdges))) { Topology.EdgeEnd = EndIndexReader->ConsumeValues(); }
+		else { Topology.EdgeEnd.Init(-1, NumEdges); }
+
+		PCGEX_DELETE(StartIndexReader)
+		PCGEX_DELETE(EndIndexReader)
+
+		Topology.Build(NumVertexPoints);
+		BuildFrom(Topology, InPoints);
 	}
 
-	void FMesh::BuildFrom(const PCGExData::FPointIO& InPoints, const PCGExData::FPointIO& InEdges)
+	void FMesh::BuildFrom(const FClusterTopology& InTopology, const PCGExData::FPointIO& InPoints)
 	{
-		TRACE_CPUPROFILER_EVENT_SCOPE(FPCGExMesh::BuildMesh);
+		const TArray<FPCGPoint>& InVerticesPoints = InPoints.GetIn()->GetPoints();
+		const int32 NumVertices = InTopology.NumVertices();
+		const int32 NumEdges = InTopology.NumEdges();
 
-		bHasInvalidEdges = false;
+		MeshID = InTopology.IslandID;
+		bHasInvalidEdges = InTopology.bHasInvalidEdges;
+		Bounds = FBox(ForceInit);
 
-		const TArray<FPCGPoint>& InVerticesPoints = InPoints.GetIn()->GetPoints();
-		const int32 NumVertices = InVerticesPoints.Num();
 		Vertices.Reset(NumVertices);
+		Vertices.SetNum(NumVertices);
 		IndicesMap.Empty(NumVertices);
 
-		const TArray<FPCGPoint>& InEdgesPoints = InEdges.GetIn()->GetPoints();
-		const int32 NumEdges = InEdgesPoints.Num();
-		Edges.Reset(NumEdges);
-
-		PCGEx::TFAttributeReader<int32>* StartIndexReader = new PCGEx::TFAttributeReader<int32>(PCGExGraph::EdgeStartAttributeName);
-		PCGEx::TFAttributeReader<int32>* EndIndexReader = new PCGEx::TFAttributeReader<int32>(PCGExGraph::EdgeEndAttributeName);
-
-		StartIndexReader->Bind(const_cast<PCGExData::FPointIO&>(InEdges));
-		EndIndexReader->Bind(const_cast<PCGExData::FPointIO&>(InEdges));
-
-		for (int i = 0; i < NumEdges; i++)
+		for (int i = 0; i < NumVertices; i++)
 		{
-			int32 VtxStart = StartIndexReader->Values[i];
-			int32 VtxEnd = EndIndexReader->Values[i];
+			const int32 PointIndex = InTopology.VertexPointIndices[i];
+			FVertex& Vertex = Vertices[i];
+			Vertex.MeshIndex = i;
+			Vertex.PointIndex = PointIndex;
+			Vertex.Position = InVerticesPoints[PointIndex].Transform.GetLocation();
+			Bounds += Vertex.Position;
 
-			if (!InVerticesPoints.IsValidIndex(VtxStart) ||
-				!InVerticesPoints.IsValidIndex(VtxEnd))
-			{
-				bHasInvalidEdges = true;
-				continue;
-			}
+			const int32 NeighborStart = InTopology.NeighborOffsets[i];
+			Vertex.Neighbors.Append(InTopology.Neighbors.GetData() + NeighborStart, InTopology.NeighborOffsets[i + 1] - NeighborStart);
 
-			Edges.Emplace_GetRef(i, VtxStart, VtxEnd);
-			bool JustCreated = false;
+			const int32 EdgeStart = InTopology.EdgeOffsets[i];
+			Vertex.Edges.Append(InTopology.Edges.GetData() + EdgeStart, InTopology.EdgeOffsets[i + 1] - EdgeStart);
 
-			FVertex& Start = GetOrCreateVertex(VtxStart, JustCreated);
-			if (JustCreated)
-			{
-				Start.Position = InVerticesPoints[VtxStart].Transform.GetLocation();
-				Bounds += Start.Position;
-			}
-
-			FVertex& End = GetOrCreateVertex(VtxEnd, JustCreated);
-			if (JustCreated)
-			{
-				End.Position = InVerticesPoints[VtxEnd].Transform.GetLocation();
-				Bounds += End.Position;
-			}
-
-			Start.AddNeighbor(i, End.MeshIndex);
-			End.AddNeighbor(i, Start.MeshIndex);
+			IndicesMap.Add(PointIndex, i);
 		}
 
-		PCGEX_DELETE(StartIndexReader)
-		PCGEX_DELETE(EndIndexReader)
+		Edges.Reset(NumEdges);
+		for (int i = 0; i < NumEdges; i++)
+		{
+			if (!InTopology.IsValidEdge(i)) { continue; }
+			Edges.Emplace_GetRef(i, InTopology.EdgeStart[i], InTopology.EdgeEnd[i]);
+		}
 	}
 
 	int32 FMesh::FindClosestVertex(const FVector& Position) const
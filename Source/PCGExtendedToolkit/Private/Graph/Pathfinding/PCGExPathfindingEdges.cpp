@@ -116,15 +116,15 @@ bool FPCGExPathfindingEdgesElement::ExecuteInternal(FPCGContext* InContext) cons
 
 	if (Context->IsState(PCGExGraph::State_ProcessingEdges))
 	{
-		auto SampleMeshTask = [&](const int32 Index)
-		{
-			Context->GetAsyncManager()->Start<FSampleMeshPathTask>(Index, Context->CurrentIO, Context->PathBuffer[Index]);
-		};
+		FPCGExAsyncManager* AsyncManager = Context->GetAsyncManager();
+		AsyncManager->StartRanges(
+			Context->PathBuffer.Num(), Context->ChunkSize, [AsyncManager, Context](const int32 Index)
+			{
+				FSampleMeshPathTask Task(AsyncManager, Index, Context->CurrentIO, Context->PathBuffer[Index]);
+				return Task.ExecuteTask();
+			});
 
-		if (Context->Process(SampleMeshTask, Context->PathBuffer.Num()))
-		{
-			Context->SetAsyncState(PCGExMT::State_WaitingOnAsyncWork);
-		}
+		Context->SetAsyncState(PCGExMT::State_WaitingOnAsyncWork);
 	}
 
 	if (Context->IsState(PCGExMT::State_WaitingOnAsyncWork))
@@ -149,7 +149,7 @@ bool FSampleMeshPathTask::ExecuteTask()
 
 	const PCGExMesh::FMesh* Mesh = Context->CurrentMesh;
 
-	TArray<int32> Path;
+	PCGExMT::TScratchArray<int32> Path;
 
 	if (!PCGExPathfinding::FindPath(
 		Context->CurrentMesh, Query->SeedPosition, Query->GoalPosition,
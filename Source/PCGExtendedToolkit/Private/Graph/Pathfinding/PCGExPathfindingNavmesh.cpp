@@ -155,16 +155,24 @@ bool FPCGExPathfindingNavmeshElement::ExecuteInternal(FPCGContext* InContext) co
 		auto NavMeshTask = [&](const int32 SeedIndex, const int32 GoalIndex)
 		{
 			Context->BufferLock.WriteLock();
-			const int32 PathIndex = Context->PathBuffer.Add(
+			Context->PathBuffer.Add(
 				new PCGExPathfinding::FPathQuery(
 					SeedIndex, Context->CurrentIO->GetInPoint(SeedIndex).Transform.GetLocation(),
 					GoalIndex, Context->GoalsPoints->GetInPoint(GoalIndex).Transform.GetLocation()));
 			Context->BufferLock.WriteUnlock();
-			Context->GetAsyncManager()->Start<FSampleNavmeshTask>(PathIndex, Context->CurrentIO, Context->PathBuffer[PathIndex]);
 		};
 
 		if (PCGExPathfinding::ProcessGoals(Initialize, Context, Context->CurrentIO, Context->GoalPicker, NavMeshTask))
 		{
+			// Queries are only sampled once all of them are known, so they can be batched
+			FPCGExAsyncManager* AsyncManager = Context->GetAsyncManager();
+			AsyncManager->StartRanges(
+				Context->PathBuffer.Num(), Context->ChunkSize, [AsyncManager, Context](const int32 Index)
+				{
+					FSampleNavmeshTask Task(AsyncManager, Index, Context->CurrentIO, Context->PathBuffer[Index]);
+					return Task.ExecuteTask();
+				});
+
 			Context->SetAsyncState(PCGExPathfinding::State_Pathfinding);
 		}
 	}
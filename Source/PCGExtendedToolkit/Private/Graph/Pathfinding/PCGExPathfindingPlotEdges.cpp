@@ -157,7 +157,7 @@ bool FPlotMeshPathTask::ExecuteTask()
 	const FPCGExPathfindingPlotEdgesContext* Context = Manager->GetContext<FPCGExPathfindingPlotEdgesContext>();
 
 	const PCGExMesh::FMesh* Mesh = Context->CurrentMesh;
-	TArray<int32> Path;
+	PCGExMT::TScratchArray<int32> Path;
 
 	const int32 NumPlots = PointIO->GetNum();
 
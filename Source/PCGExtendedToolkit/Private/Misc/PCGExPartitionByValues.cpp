@@ -4,6 +4,7 @@
 #include "Misc/PCGExPartitionByValues.h"
 
 #include "Data/PCGExData.h"
+#include "Async/ParallelFor.h"
 
 #define LOCTEXT_NAMESPACE "PCGExPartitionByValues"
 #define PCGEX_NAMESPACE PartitionByValues
@@ -39,41 +40,140 @@ namespace PCGExPartition
 
 	FKPartition* FKPartition::GetPartition(const int64 Key, FPCGExFilter::FRule* InRule)
 	{
-		FKPartition** LayerPtr;
+		if (FKPartition** LayerPtr = SubLayers.Find(Key)) { return *LayerPtr; }
 
+		FKPartition* Partition = new FKPartition(this, Key, InRule);
+		SubLayers.Add(Key, Partition);
+		return Partition;
+	}
+
+	void FKPartition::Register(TArray<FKPartition*>& Partitions)
+	{
+		if (!SubLayers.IsEmpty())
 		{
-			FReadScopeLock ReadLock(LayersLock);
-			LayerPtr = SubLayers.Find(Key);
+			for (const TPair<int64, FKPartition*>& Pair : SubLayers) { Pair.Value->Register(Partitions); }
 		}
-
-		if (!LayerPtr)
+		else
 		{
-			FWriteScopeLock WriteLock(LayersLock);
-			FKPartition* Partition = new FKPartition(this, Key, InRule);
-
-			SubLayers.Add(Key, Partition);
-			return Partition;
+			Partitions.Add(this);
 		}
-
-		return *LayerPtr;
 	}
 
-	void FKPartition::Add(const int64 Index)
+	/** A point's keys across all rules, pointing into the shared keys array. */
+	struct FKeyTuple
 	{
-		FWriteScopeLock WriteLock(PointLock);
-		Points.Add(Index);
-	}
+		const int64* Keys = nullptr;
+		int32 Num = 0;
+		uint32 Hash = 0;
 
-	void FKPartition::Register(TArray<FKPartition*>& Partitions)
+		FKeyTuple(const int64* InKeys, const int32 InNum)
+			: Keys(InKeys), Num(InNum)
+		{
+			for (int i = 0; i < Num; i++) { Hash = HashCombine(Hash, GetTypeHash(Keys[i])); }
+		}
+
+		bool operator==(const FKeyTuple& Other) const { return Num == 0 || FMemory::Memcmp(Keys, Other.Keys, Num * sizeof(int64)) == 0; }
+		friend uint32 GetTypeHash(const FKeyTuple& Tuple) { return Tuple.Hash; }
+	};
+
+	struct FBucketChunk
 	{
-		if (!SubLayers.IsEmpty())
+		TMap<FKeyTuple, int32> Buckets;
+		TArray<int32> FirstPoints; // First point of each local bucket, used to walk the tree
+		TArray<int32> Counts;
+		TArray<int32> Cursors;
+		TArray<FKPartition*> Leaves;
+	};
+
+	void FKPartition::Distribute(
+		TArray<FPCGExFilter::FRule>& Rules, const TArray<int64>& Keys, const int32 InNumPoints,
+		TArray<FKPartition*>& OutPartitions, TArray<int32>& OutPointOrder, const bool bParallel)
+	{
+		constexpr int32 BucketChunkSize = 4096;
+		const int32 NumRules = Rules.Num();
+		const int32 NumChunks = FMath::DivideAndRoundUp(InNumPoints, BucketChunkSize);
+
+		TArray<FBucketChunk> Chunks;
+		Chunks.SetNum(NumChunks);
+
+		TArray<int32> PointBuckets;
+		PointBuckets.SetNumUninitialized(InNumPoints);
+
+		// Per-chunk buckets, nothing shared is written
+		ParallelFor(
+			NumChunks, [&](const int32 ChunkIndex)
+			{
+				FBucketChunk& Chunk = Chunks[ChunkIndex];
+				const int32 Start = ChunkIndex * BucketChunkSize;
+				const int32 End = FMath::Min(Start + BucketChunkSize, InNumPoints);
+
+				for (int i = Start; i < End; i++)
+				{
+					const FKeyTuple Tuple(Keys.GetData() + i * NumRules, NumRules);
+
+					int32 LocalBucket;
+					if (const int32* Existing = Chunk.Buckets.Find(Tuple)) { LocalBucket = *Existing; }
+					else
+					{
+						LocalBucket = Chunk.Counts.Add(0);
+						Chunk.FirstPoints.Add(i);
+						Chunk.Buckets.Add(Tuple, LocalBucket);
+					}
+
+					Chunk.Counts[LocalBucket]++;
+					PointBuckets[i] = LocalBucket;
+				}
+			}, !bParallel);
+
+		// Merge local buckets into the tree; only unique keys per chunk walk it
+		for (FBucketChunk& Chunk : Chunks)
 		{
-			for (const TPair<int64, FKPartition*>& Pair : SubLayers) { Pair.Value->Register(Partitions); }
+			Chunk.Leaves.SetNumUninitialized(Chunk.Counts.Num());
+			for (int b = 0; b < Chunk.Counts.Num(); b++)
+			{
+				FKPartition* Leaf = this;
+				const int64* PointKeys = Keys.GetData() + Chunk.FirstPoints[b] * NumRules;
+				for (int r = 0; r < NumRules; r++) { Leaf = Leaf->GetPartition(PointKeys[r], &Rules[r]); }
+				Leaf->NumPoints += Chunk.Counts[b];
+				Chunk.Leaves[b] = Leaf;
+			}
 		}
-		else
+
+		OutPartitions.Reset();
+		Register(OutPartitions);
+
+		TMap<FKPartition*, int32> WriteIndices;
+		WriteIndices.Reserve(OutPartitions.Num());
+
+		int32 FirstIndex = 0;
+		for (FKPartition* Leaf : OutPartitions)
 		{
-			Partitions.Add(this);
+			Leaf->FirstIndex = FirstIndex;
+			WriteIndices.Add(Leaf, FirstIndex);
+			FirstIndex += Leaf->NumPoints;
 		}
+
+		// Chunks claim their slice of each leaf range in order, which keeps partitions stable
+		for (FBucketChunk& Chunk : Chunks)
+		{
+			Chunk.Cursors.SetNumUninitialized(Chunk.Counts.Num());
+			for (int b = 0; b < Chunk.Counts.Num(); b++)
+			{
+				int32& WriteIndex = *WriteIndices.Find(Chunk.Leaves[b]);
+				Chunk.Cursors[b] = WriteIndex;
+				WriteIndex += Chunk.Counts[b];
+			}
+		}
+
+		OutPointOrder.SetNumUninitialized(InNumPoints);
+		ParallelFor(
+			NumChunks, [&](const int32 ChunkIndex)
+			{
+				FBucketChunk& Chunk = Chunks[ChunkIndex];
+				const int32 Start = ChunkIndex * BucketChunkSize;
+				const int32 End = FMath::Min(Start + BucketChunkSize, InNumPoints);
+				for (int i = Start; i < End; i++) { OutPointOrder[Chunk.Cursors[PointBuckets[i]]++] = i; }
+			}, !bParallel);
 	}
 }
 
@@ -149,66 +249,52 @@ bool FPCGExPartitionByValuesElement::ExecuteInternal(FPCGContext* InContext) con
 
 	if (Context->IsState(PCGExMT::State_ProcessingPoints))
 	{
-		auto Initialize = [&](PCGExData::FPointIO& PointIO)
-		{
-			Context->Rules.Empty();
-			PointIO.CreateInKeys();
+		PCGExData::FPointIO& PointIO = *Context->CurrentIO;
 
-			for (FPCGExFilterRuleDescriptor& Descriptor : Context->RulesDescriptors)
-			{
-				FPCGExFilter::FRule& NewRule = Context->Rules.Emplace_GetRef(Descriptor);
-				if (!NewRule.Bind(PointIO)) { Context->Rules.Pop(); }
-			}
+		Context->Rules.Empty();
+		PointIO.CreateInKeys();
 
-			// Prepare each rule so it cache the filter key by index
-			if (!Context->bSplitOutput)
-			{
-				const int32 NumPoints = PointIO.GetNum();
-				for (FPCGExFilter::FRule& Rule : Context->Rules)
-				{
-					if (!Rule.RuleDescriptor->bWriteKey) { continue; }
-					Rule.FilteredValues.SetNumZeroed(NumPoints);
-				}
-			}
-		};
+		for (FPCGExFilterRuleDescriptor& Descriptor : Context->RulesDescriptors)
+		{
+			FPCGExFilter::FRule& NewRule = Context->Rules.Emplace_GetRef(Descriptor);
+			if (!NewRule.Bind(PointIO)) { Context->Rules.Pop(); }
+		}
+
+		const int32 NumPoints = PointIO.GetNum();
+		const int32 NumRules = Context->Rules.Num();
 
-		auto ProcessPoint = [&](const int32 PointIndex, const PCGExData::FPointIO& PointIO)
+		if (!Context->bSplitOutput)
 		{
-			PCGExPartition::FKPartition* Partition = Context->RootPartition;
 			for (FPCGExFilter::FRule& Rule : Context->Rules)
 			{
-				const int64 KeyValue = Rule.Filter(PointIndex);
-				Partition = Partition->GetPartition(KeyValue, &Rule);
-				if (!Context->bSplitOutput && Rule.RuleDescriptor->bWriteKey) { Rule.FilteredValues[PointIndex] = KeyValue; }
+				if (!Rule.RuleDescriptor->bWriteKey) { continue; }
+
+				Rule.FilteredValues.SetNumUninitialized(NumPoints);
+				ParallelFor(NumPoints, [&](const int32 PointIndex) { Rule.FilteredValues[PointIndex] = Rule.Filter(PointIndex); }, !Context->bDoAsyncProcessing);
+
+				PCGEx::FAttributeAccessor<int64>* Accessor = PCGEx::FAttributeAccessor<int64>::FindOrCreate(PointIO, Rule.RuleDescriptor->KeyAttributeName, 0, false);
+				Accessor->SetRange(Rule.FilteredValues);
+				delete Accessor;
 			}
 
-			Partition->Add(PointIndex);
-		};
+			Context->OutputPoints();
+			Context->Done();
+			return Context->IsDone();
+		}
 
-		if (Context->ProcessCurrentPoints(Initialize, ProcessPoint))
-		{
-			if (Context->bSplitOutput)
+		TArray<int64> Keys;
+		Keys.SetNumUninitialized(NumPoints * NumRules);
+		ParallelFor(
+			NumPoints, [&](const int32 PointIndex)
 			{
-				Context->NumPartitions = Context->RootPartition->GetSubPartitionsNum();
-				Context->Partitions.Reserve(Context->NumPartitions);
-				Context->RootPartition->Register(Context->Partitions);
+				int64* PointKeys = Keys.GetData() + PointIndex * NumRules;
+				for (int r = 0; r < NumRules; r++) { PointKeys[r] = Context->Rules[r].Filter(PointIndex); }
+			}, !Context->bDoAsyncProcessing);
 
-				Context->SetState(PCGExPartition::State_DistributeToPartition);
-			}
-			else
-			{
-				for (FPCGExFilter::FRule& Rule : Context->Rules)
-				{
-					if (!Rule.RuleDescriptor->bWriteKey) { continue; }
-					PCGEx::FAttributeAccessor<int64>* Accessor = PCGEx::FAttributeAccessor<int64>::FindOrCreate(*Context->CurrentIO, Rule.RuleDescriptor->KeyAttributeName, 0, false);
-					Accessor->SetRange(Rule.FilteredValues);
-					delete Accessor;
-				}
+		Context->RootPartition->Distribute(Context->Rules, Keys, NumPoints, Context->Partitions, Context->PartitionedPoints, Context->bDoAsyncProcessing);
+		Context->NumPartitions = Context->Partitions.Num();
 
-				Context->OutputPoints();
-				Context->Done();
-			}
-		}
+		Context->SetState(PCGExPartition::State_DistributeToPartition);
 	}
 
 	if (Context->IsState(PCGExPartition::State_DistributeToPartition))
@@ -222,9 +308,10 @@ bool FPCGExPartitionByValuesElement::ExecuteInternal(FPCGContext* InContext) con
 
 			const TArray<FPCGPoint>& InPoints = InData->GetPoints();
 			TArray<FPCGPoint>& OutPoints = OutData->GetMutablePoints();
-			OutPoints.Reserve(Partition->Points.Num());
+			OutPoints.SetNumUninitialized(Partition->NumPoints);
 
-			for (const int32 PointIndex : Partition->Points) { OutPoints.Add(InPoints[PointIndex]); }
+			const int32* PointIndices = Context->PartitionedPoints.GetData() + Partition->FirstIndex;
+			for (int i = 0; i < Partition->NumPoints; i++) { OutPoints[i] = InPoints[PointIndices[i]]; }
 
 			while (Partition->Parent)
 			{
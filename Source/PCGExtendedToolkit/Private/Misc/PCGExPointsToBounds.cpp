@@ -3,7 +3,9 @@
 
 #include "Misc/PCGExPointsToBounds.h"
 
+#include "PCGExMath.h"
 #include "Data/PCGExData.h"
+#include "Async/ParallelFor.h"
 
 #define LOCTEXT_NAMESPACE "PCGExPointsToBoundsElement"
 #define PCGEX_NAMESPACE PointsToBounds
@@ -35,6 +37,36 @@ void UPCGExPointsToBoundsSettings::PostEditChangeProperty(FPropertyChangedEvent&
 
 PCGEX_INITIALIZE_ELEMENT(PointsToBounds)
 
+namespace PCGExPointsToBounds
+{
+	constexpr int32 ChunkSize = 4096;
+
+	/**
+	 * Chunked reduction over [0, NumPoints[.
+	 * Each chunk accumulates into its own partial, partials are then merged serially in chunk order.
+	 */
+	template <typename T, typename AccumulateFunc, typename MergeFunc>
+	static T Reduce(const int32 NumPoints, const T& Identity, AccumulateFunc&& Accumulate, MergeFunc&& Merge, const bool bParallel)
+	{
+		const int32 NumChunks = FMath::DivideAndRoundUp(NumPoints, ChunkSize);
+
+		TArray<T> Partials;
+		Partials.Init(Identity, NumChunks);
+
+		ParallelFor(
+			NumChunks, [&](const int32 ChunkIndex)
+			{
+				T& Partial = Partials[ChunkIndex];
+				const int32 End = FMath::Min(NumPoints, (ChunkIndex + 1) * ChunkSize);
+				for (int i = ChunkIndex * ChunkSize; i < End; i++) { Accumulate(Partial, i); }
+			}, !bParallel);
+
+		T Result = Identity;
+		for (const T& Partial : Partials) { Merge(Result, Partial); }
+		return Result;
+	}
+}
+
 bool FPCGExPointsToBoundsElement::Boot(FPCGContext* InContext) const
 {
 	if (!FPCGExPointsProcessorElementBase::Boot(InContext)) { return false; }
@@ -72,33 +104,91 @@ bool FPCGExPointsToBoundsElement::ExecuteInternal(FPCGContext* InContext) const
 		MutablePoints.Add(InPoints[0]);
 
 		Context->MetadataBlender->PrepareForData(*Context->CurrentIO);
-		const double AverageDivider = InPoints.Num();
+		const int32 NumPoints = InPoints.Num();
+		const double AverageDivider = NumPoints;
+		const bool bParallel = Context->bDoAsyncProcessing;
 
-		FBox Box = FBox(ForceInit);
-		for (int i = 0; i < AverageDivider; i++) { Box += InPoints[i].Transform.GetLocation(); }
+		struct FBoundsPartial
+		{
+			FBox Box = FBox(ForceInit);
+			FVector Sum = FVector::ZeroVector;
+		};
+
+		const FBoundsPartial Bounds = PCGExPointsToBounds::Reduce(
+			NumPoints, FBoundsPartial{},
+			[&](FBoundsPartial& Partial, const int32 Index)
+			{
+				const FVector Location = InPoints[Index].Transform.GetLocation();
+				Partial.Box += Location;
+				Partial.Sum += Location;
+			},
+			[](FBoundsPartial& Result, const FBoundsPartial& Partial)
+			{
+				Result.Box += Partial.Box;
+				Result.Sum += Partial.Sum;
+			}, bParallel);
+
+		FQuat Rotation = InPoints[0].Transform.GetRotation();
+		FVector Center = Bounds.Box.GetCenter();
+		FBox LocalBox = Bounds.Box.ShiftBy(-Center);
+
+		if (Settings->bOrientedBounds)
+		{
+			const FVector Mean = Bounds.Sum / AverageDivider;
+
+			const FMatrix Covariance = PCGExPointsToBounds::Reduce(
+				NumPoints, FMatrix(ForceInitToZero),
+				[&](FMatrix& Partial, const int32 Index)
+				{
+					const FVector D = InPoints[Index].Transform.GetLocation() - Mean;
+					Partial.M[0][0] += D.X * D.X;
+					Partial.M[0][1] += D.X * D.Y;
+					Partial.M[0][2] += D.X * D.Z;
+					Partial.M[1][1] += D.Y * D.Y;
+					Partial.M[1][2] += D.Y * D.Z;
+					Partial.M[2][2] += D.Z * D.Z;
+				},
+				[](FMatrix& Result, const FMatrix& Partial)
+				{
+					for (int i = 0; i < 3; i++) { for (int j = i; j < 3; j++) { Result.M[i][j] += Partial.M[i][j]; } }
+				}, bParallel);
+
+			FMatrix SymmetricCovariance = Covariance;
+			SymmetricCovariance.M[1][0] = Covariance.M[0][1];
+			SymmetricCovariance.M[2][0] = Covariance.M[0][2];
+			SymmetricCovariance.M[2][1] = Covariance.M[1][2];
+
+			Rotation = PCGExMath::GetPrincipalAxes(SymmetricCovariance);
+
+			const FBox OrientedBox = PCGExPointsToBounds::Reduce(
+				NumPoints, FBox(ForceInit),
+				[&](FBox& Partial, const int32 Index) { Partial += Rotation.UnrotateVector(InPoints[Index].Transform.GetLocation() - Mean); },
+				[](FBox& Result, const FBox& Partial) { Result += Partial; }, bParallel);
+
+			const FVector LocalCenter = OrientedBox.GetCenter();
+			Center = Mean + Rotation.RotateVector(LocalCenter);
+			LocalBox = OrientedBox.ShiftBy(-LocalCenter);
+		}
 
-		const FVector Center = Box.GetCenter();
-		const double SqrDist = Box.GetExtent().SquaredLength();
+		const double SqrDist = LocalBox.GetExtent().SquaredLength();
 
-		MutablePoints[0].Transform.SetLocation(Center);
-		MutablePoints[0].BoundsMin = Box.Min - Center;
-		MutablePoints[0].BoundsMax = Box.Max - Center;
+		TArray<double> Weights;
+		Weights.SetNumUninitialized(NumPoints);
+		ParallelFor(
+			NumPoints, [&](const int32 Index)
+			{
+				Weights[Index] = SqrDist > 0 ? FVector::DistSquared(Center, InPoints[Index].Transform.GetLocation()) / SqrDist : 0;
+			}, !bParallel);
 
 		const PCGEx::FPointRef Target = Context->CurrentIO->GetOutPointRef(0);
 		Context->MetadataBlender->PrepareForBlending(Target);
-
-		for (int i = 0; i < AverageDivider; i++)
-		{
-			FVector Location = InPoints[i].Transform.GetLocation();
-			const double Weight = FVector::DistSquared(Center, Location) / SqrDist;
-			Context->MetadataBlender->Blend(Target, Context->CurrentIO->GetInPointRef(i), Target, Weight);
-		}
-
+		Context->MetadataBlender->BlendRangeInto(Target, 0, NumPoints, Weights, bParallel);
 		Context->MetadataBlender->CompleteBlending(Target, AverageDivider);
 
 		MutablePoints[0].Transform.SetLocation(Center);
-		MutablePoints[0].BoundsMin = Box.Min - Center;
-		MutablePoints[0].BoundsMax = Box.Max - Center;
+		if (Settings->bOrientedBounds) { MutablePoints[0].Transform.SetRotation(Rotation); }
+		MutablePoints[0].BoundsMin = LocalBox.Min;
+		MutablePoints[0].BoundsMax = LocalBox.Max;
 
 		PCGEX_WRITE_MARK(PointsCount, AverageDivider)
 
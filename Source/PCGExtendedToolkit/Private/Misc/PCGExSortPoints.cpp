@@ -5,13 +5,269 @@
 #include "Misc/PCGExSortPoints.h"
 
 #include "Misc/PCGExCompare.h"
+#include "Algo/StableSort.h"
+#include "Async/ParallelFor.h"
 
 #define LOCTEXT_NAMESPACE "PCGExSortPoints"
 #define PCGEX_NAMESPACE SortPoints
 
+namespace PCGExSortPoints
+{
+	using FIndexComparer = TFunction<int(const int32, const int32)>;
+
+	/**
+	 * Extract a rule's values for every input point, once, and hand them to OnKeys as a TSharedPtr<const TArray<T>>.
+	 * Attribute values come from the input attribute cache when possible.
+	 */
+	template <typename FuncType>
+	static bool ExtractKeys(PCGExData::FPointIO& PointIO, const FPCGExSortRule& Rule, const bool bParallel, FuncType&& OnKeys)
+	{
+		const TArray<FPCGPoint>& InPoints = PointIO.GetIn()->GetPoints();
+		const int32 NumPoints = InPoints.Num();
+
+		auto ExtractFromPoints = [&](auto Get)
+		{
+			using T = std::decay_t<decltype(Get(InPoints[0]))>;
+			const TSharedPtr<TArray<T>> Keys = MakeShared<TArray<T>>();
+			Keys->SetNum(NumPoints);
+			TArray<T>& KeysRef = *Keys;
+			ParallelFor(NumPoints, [&](const int32 Index) { KeysRef[Index] = Get(InPoints[Index]); }, !bParallel);
+			OnKeys(TSharedPtr<const TArray<T>>(Keys));
+		};
+
+#define PCGEX_EXTRACT_PROPERTY_CASE(_ENUM, _ACCESSOR) \
+case _ENUM : ExtractFromPoints([](const FPCGPoint& Point) { return Point._ACCESSOR; }); return true;
+
+		switch (Rule.Selector.GetSelection())
+		{
+		case EPCGAttributePropertySelection::Attribute:
+			PCGMetadataAttribute::CallbackWithRightType(
+				Rule.UnderlyingType, [&](auto DummyValue)
+				{
+					using T = decltype(DummyValue);
+					if (const TSharedPtr<const TArray<T>> Keys = PCGEx::ReadCachedColumn<T>(PointIO, Rule.GetName()))
+					{
+						OnKeys(Keys);
+						return;
+					}
+
+					const FPCGMetadataAttribute<T>* Attribute = static_cast<const FPCGMetadataAttribute<T>*>(Rule.Attribute);
+					ExtractFromPoints([&](const FPCGPoint& Point) { return Attribute->GetValueFromItemKey(Point.MetadataEntry); });
+				});
+			return true;
+		case EPCGAttributePropertySelection::PointProperty:
+			switch (Rule.Selector.GetPointProperty())
+			{
+			PCGEX_FOREACH_POINTPROPERTY(PCGEX_EXTRACT_PROPERTY_CASE)
+			default: ;
+			}
+			return false;
+		case EPCGAttributePropertySelection::ExtraProperty:
+			switch (Rule.Selector.GetExtraProperty())
+			{
+			PCGEX_FOREACH_POINTEXTRAPROPERTY(PCGEX_EXTRACT_PROPERTY_CASE)
+			default: ;
+			}
+			return false;
+		default: ;
+		}
+
+#undef PCGEX_EXTRACT_PROPERTY_CASE
+
+		return false;
+	}
+
+	template <typename T>
+	static FIndexComparer MakeComparer(const TSharedPtr<const TArray<T>>& Keys, const FPCGExSortRule& Rule)
+	{
+		const double Tolerance = Rule.Tolerance;
+		const EPCGExOrderedFieldSelection FieldSelection = Rule.OrderFieldSelection;
+		return [Keys, Tolerance, FieldSelection](const int32 A, const int32 B)
+		{
+			return FPCGExCompare::Compare((*Keys)[A], (*Keys)[B], Tolerance, FieldSelection);
+		};
+	}
+
+	/**
+	 * Whether sorting by this rule alone is an exact ordering of a scalar, that radix sort can reproduce.
+	 * Integers are exact for any tolerance below 1; floating point values only without tolerance.
+	 */
+	static bool IsRadixSortable(const FPCGExSortRule& Rule)
+	{
+		bool bInteger = false;
+		bool bFloat = false;
+
+		switch (Rule.Selector.GetSelection())
+		{
+		case EPCGAttributePropertySelection::Attribute:
+			switch (static_cast<EPCGMetadataTypes>(Rule.UnderlyingType))
+			{
+			case EPCGMetadataTypes::Boolean:
+			case EPCGMetadataTypes::Integer32:
+			case EPCGMetadataTypes::Integer64:
+				bInteger = true;
+				break;
+			case EPCGMetadataTypes::Float:
+			case EPCGMetadataTypes::Double:
+				bFloat = true;
+				break;
+			default: ;
+			}
+			break;
+		case EPCGAttributePropertySelection::PointProperty:
+			bInteger = Rule.Selector.GetPointProperty() == EPCGPointProperties::Seed;
+			bFloat = Rule.Selector.GetPointProperty() == EPCGPointProperties::Density || Rule.Selector.GetPointProperty() == EPCGPointProperties::Steepness;
+			break;
+		case EPCGAttributePropertySelection::ExtraProperty:
+			bInteger = Rule.Selector.GetExtraProperty() == EPCGExtraProperties::Index;
+			break;
+		default: ;
+		}
+
+		return bInteger ? Rule.Tolerance < 1 : bFloat && Rule.Tolerance <= 0;
+	}
+
+	/** Map a scalar to an unsigned key with the same ordering. */
+	template <typename T>
+	static uint64 GetRadixKey(const T Value)
+	{
+		constexpr uint64 SignBit = 1ull << 63;
+		if constexpr (std::is_floating_point_v<T>)
+		{
+			const double AsDouble = static_cast<double>(Value);
+			uint64 Bits;
+			FMemory::Memcpy(&Bits, &AsDouble, sizeof(uint64));
+			return (Bits & SignBit) ? ~Bits : Bits | SignBit;
+		}
+		else
+		{
+			return static_cast<uint64>(static_cast<int64>(Value)) ^ SignBit;
+		}
+	}
+
+	/**
+	 * Stable LSD radix sort of Order by Keys[Order[i]], 8 bits per pass.
+	 * Each pass builds per-chunk histograms & scatters in parallel; passes where all keys share the same byte are skipped.
+	 */
+	static void RadixSort(const TArray<uint64>& Keys, TArray<int32>& Order, const bool bParallel)
+	{
+		const int32 NumItems = Order.Num();
+		if (NumItems < 2) { return; }
+
+		constexpr int32 RadixChunkSize = 16384;
+		const int32 NumChunks = bParallel ? FMath::DivideAndRoundUp(NumItems, RadixChunkSize) : 1;
+		const int32 ChunkSize = FMath::DivideAndRoundUp(NumItems, NumChunks);
+
+		TArray<int32> Buffer;
+		Buffer.SetNumUninitialized(NumItems);
+
+		TArray<int32> Histograms;
+		Histograms.SetNumUninitialized(NumChunks * 256);
+
+		int32* Src = Order.GetData();
+		int32* Dst = Buffer.GetData();
+
+		for (int32 Shift = 0; Shift < 64; Shift += 8)
+		{
+			ParallelFor(
+				NumChunks, [&](const int32 ChunkIndex)
+				{
+					int32* Histogram = Histograms.GetData() + ChunkIndex * 256;
+					FMemory::Memzero(Histogram, 256 * sizeof(int32));
+					const int32 End = FMath::Min((ChunkIndex + 1) * ChunkSize, NumItems);
+					for (int i = ChunkIndex * ChunkSize; i < End; i++) { Histogram[(Keys[Src[i]] >> Shift) & 0xFF]++; }
+				}, !bParallel);
+
+			bool bSingleBucket = false;
+			int32 Offset = 0;
+			for (int b = 0; b < 256; b++)
+			{
+				const int32 BucketStart = Offset;
+				for (int c = 0; c < NumChunks; c++)
+				{
+					int32& Count = Histograms[c * 256 + b];
+					const int32 ChunkCount = Count;
+					Count = Offset;
+					Offset += ChunkCount;
+				}
+				if (Offset - BucketStart == NumItems)
+				{
+					bSingleBucket = true;
+					break;
+				}
+			}
+
+			if (bSingleBucket) { continue; }
+
+			ParallelFor(
+				NumChunks, [&](const int32 ChunkIndex)
+				{
+					int32* Cursors = Histograms.GetData() + ChunkIndex * 256;
+					const int32 End = FMath::Min((ChunkIndex + 1) * ChunkSize, NumItems);
+					for (int i = ChunkIndex * ChunkSize; i < End; i++) { Dst[Cursors[(Keys[Src[i]] >> Shift) & 0xFF]++] = Src[i]; }
+				}, !bParallel);
+
+			Swap(Src, Dst);
+		}
+
+		if (Src != Order.GetData()) { FMemory::Memcpy(Order.GetData(), Src, NumItems * sizeof(int32)); }
+	}
+
+	/**
+	 * Stable parallel merge sort : runs are sorted concurrently, then merged pairwise, each round in parallel.
+	 */
+	static void MergeSort(TArray<int32>& Order, const TFunctionRef<bool(const int32, const int32)>& Less, const bool bParallel)
+	{
+		const int32 NumItems = Order.Num();
+		constexpr int32 MinRunSize = 4096;
+		const int32 NumRuns = bParallel ? FMath::Clamp(NumItems / MinRunSize, 1, 64) : 1;
+
+		auto RunStart = [&](const int32 Run) { return static_cast<int32>(static_cast<int64>(NumItems) * Run / NumRuns); };
+
+		ParallelFor(
+			NumRuns, [&](const int32 Run)
+			{
+				const int32 Start = RunStart(Run);
+				TArrayView<int32> RunView = MakeArrayView(Order.GetData() + Start, RunStart(Run + 1) - Start);
+				Algo::StableSort(RunView, Less);
+			}, !bParallel);
+
+		if (NumRuns == 1) { return; }
+
+		TArray<int32> Buffer;
+		Buffer.SetNumUninitialized(NumItems);
+
+		int32* Src = Order.GetData();
+		int32* Dst = Buffer.GetData();
+
+		for (int32 Width = 1; Width < NumRuns; Width *= 2)
+		{
+			const int32 NumMerges = FMath::DivideAndRoundUp(NumRuns, Width * 2);
+			ParallelFor(
+				NumMerges, [&](const int32 MergeIndex)
+				{
+					const int32 Left = RunStart(MergeIndex * Width * 2);
+					const int32 Mid = RunStart(FMath::Min((MergeIndex * 2 + 1) * Width, NumRuns));
+					const int32 Right = RunStart(FMath::Min((MergeIndex * 2 + 2) * Width, NumRuns));
+
+					int32 A = Left;
+					int32 B = Mid;
+					int32 Out = Left;
+					while (A < Mid && B < Right) { Dst[Out++] = Less(Src[B], Src[A]) ? Src[B++] : Src[A++]; }
+					while (A < Mid) { Dst[Out++] = Src[A++]; }
+					while (B < Right) { Dst[Out++] = Src[B++]; }
+				}, !bParallel);
+
+			Swap(Src, Dst);
+		}
+
+		if (Src != Order.GetData()) { FMemory::Memcpy(Order.GetData(), Src, NumItems * sizeof(int32)); }
+	}
+}
+
 FPCGElementPtr UPCGExSortPointsSettings::CreateElement() const { return MakeShared<FPCGExSortPointsElement>(); }
 
-PCGExData::EInit UPCGExSortPointsSettings::GetMainOutputInitMode() const { return PCGExData::EInit::DuplicateInput; }
+PCGExData::EInit UPCGExSortPointsSettings::GetMainOutputInitMode() const { return PCGExData::EInit::NewOutput; }
 
 bool FPCGExSortPointsElement::ExecuteInternal(FPCGContext* InContext) const
 {
@@ -41,57 +297,68 @@ bool FPCGExSortPointsElement::ExecuteInternal(FPCGContext* InContext) const
 		for (const FPCGExSortRule& DesiredRule : Settings->Rules)
 		{
 			FPCGExSortRule& Rule = Rules.Emplace_GetRef(DesiredRule);
-			if (!Rule.Validate(PointIO.GetOut())) { Rules.Pop(); }
+			if (!Rule.Validate(PointIO.GetIn())) { Rules.Pop(); }
 		}
 
 		if (Rules.IsEmpty()) { return; } // Could not sort, omit output.
 
-		auto Compare = [&](auto DummyValue, const FPCGExSortRule* Rule, const FPCGPoint& PtA, const FPCGPoint& PtB) -> int
-		{
-			using T = decltype(DummyValue);
-			FPCGMetadataAttribute<T>* Attribute = static_cast<FPCGMetadataAttribute<T>*>(Rule->Attribute);
-			return FPCGExCompare::Compare(
-				Attribute->GetValueFromItemKey(PtA.MetadataEntry),
-				Attribute->GetValueFromItemKey(PtB.MetadataEntry),
-				Rule->Tolerance, Rule->OrderFieldSelection);
-		};
+		const bool bParallel = Context->bDoAsyncProcessing;
+		const bool bDescending = Settings->SortDirection == EPCGExSortDirection::Descending;
+
+		const TArray<FPCGPoint>& InPoints = PointIO.GetIn()->GetPoints();
+		const int32 NumPoints = InPoints.Num();
 
-		auto SortPredicate = [&](const FPCGPoint& A, const FPCGPoint& B)
+		// Sort a permutation over keys extracted once, rather than points through attribute lookups
+		TArray<int32> Order;
+		Order.SetNumUninitialized(NumPoints);
+		for (int i = 0; i < NumPoints; i++) { Order[i] = i; }
+
+		if (Rules.Num() == 1 && PCGExSortPoints::IsRadixSortable(Rules[0]))
 		{
-#define PCGEX_COMPARE_PROPERTY_CASE(_ENUM, _ACCESSOR) \
-case _ENUM : Result = FPCGExCompare::Compare(A._ACCESSOR, B._ACCESSOR, Rule.Tolerance, Rule.OrderFieldSelection); break;
+			TArray<uint64> RadixKeys;
+			RadixKeys.SetNumUninitialized(NumPoints);
 
-			int Result = 0;
-			for (const FPCGExSortRule& Rule : Rules)
-			{
-				switch (Rule.Selector.GetSelection())
+			PCGExSortPoints::ExtractKeys(
+				PointIO, Rules[0], bParallel, [&](const auto& Keys)
 				{
-				case EPCGAttributePropertySelection::Attribute:
-					Result = PCGMetadataAttribute::CallbackWithRightType(Rule.UnderlyingType, Compare, &Rule, A, B);
-					break;
-				case EPCGAttributePropertySelection::PointProperty:
-					switch (Rule.Selector.GetPointProperty())
-					{
-					PCGEX_FOREACH_POINTPROPERTY(PCGEX_COMPARE_PROPERTY_CASE)
-					}
-					break;
-				case EPCGAttributePropertySelection::ExtraProperty:
-					switch (Rule.Selector.GetExtraProperty())
+					using T = typename std::decay_t<decltype(*Keys)>::ElementType;
+					if constexpr (std::is_arithmetic_v<T>)
 					{
-					PCGEX_FOREACH_POINTEXTRAPROPERTY(PCGEX_COMPARE_PROPERTY_CASE)
+						const TArray<T>& Values = *Keys;
+						ParallelFor(
+							NumPoints, [&](const int32 i)
+							{
+								const uint64 Key = PCGExSortPoints::GetRadixKey(Values[i]);
+								RadixKeys[i] = bDescending ? ~Key : Key;
+							}, !bParallel);
 					}
-					break;
-				default: ;
-				}
+				});
 
-				if (Result != 0) { break; }
+			PCGExSortPoints::RadixSort(RadixKeys, Order, bParallel);
+		}
+		else
+		{
+			TArray<PCGExSortPoints::FIndexComparer> Comparers;
+			for (const FPCGExSortRule& Rule : Rules)
+			{
+				PCGExSortPoints::ExtractKeys(PointIO, Rule, bParallel, [&](const auto& Keys) { Comparers.Add(PCGExSortPoints::MakeComparer(Keys, Rule)); });
 			}
 
-			if (Settings->SortDirection == EPCGExSortDirection::Descending) { Result *= -1; }
-			return Result <= 0;
-		};
+			const int32 Sign = bDescending ? -1 : 1;
+			PCGExSortPoints::MergeSort(
+				Order, [&](const int32 A, const int32 B)
+				{
+					for (const PCGExSortPoints::FIndexComparer& Comparer : Comparers)
+					{
+						if (const int Result = Comparer(A, B)) { return Result * Sign < 0; }
+					}
+					return false;
+				}, bParallel);
+		}
 
-		PointIO.GetOut()->GetMutablePoints().Sort(SortPredicate);
+		TArray<FPCGPoint>& OutPoints = PointIO.GetOut()->GetMutablePoints();
+		OutPoints.SetNumUninitialized(NumPoints);
+		ParallelFor(NumPoints, [&](const int32 i) { OutPoints[i] = InPoints[Order[i]]; }, !bParallel);
 
 		{
 			FWriteScopeLock WriteLock(Context->ContextLock);
@@ -109,8 +376,5 @@ case _ENUM : Result = FPCGExCompare::Compare(A._ACCESSOR, B._ACCESSOR, Rule.Tole
 	return Context->IsDone();
 }
 
-#undef PCGEX_COMPARE_PROPERTY
-#undef PCGEX_COMPARE_PROPERTY_CASE
-
 #undef LOCTEXT_NAMESPACE
 #undef PCGEX_NAMESPACE
@@ -17,6 +17,21 @@ void FPCGExAsyncManager::OnAsyncTaskExecutionComplete(FPCGExNonAbandonableTask*
 	NumCompleted++;
 }
 
+void FPCGExAsyncManager::StartRanges(const int32 NumIterations, const int32 MinBatchSize, TFunction<bool(int32)>&& RunIndex)
+{
+	if (NumIterations <= 0) { return; }
+
+	const int32 BatchSize = PCGExMT::GetBatchSize(NumIterations, MinBatchSize);
+	Reserve(QueuedTasks.Num() + FMath::DivideAndRoundUp(NumIterations, BatchSize));
+
+	for (int32 StartIndex = 0; StartIndex < NumIterations; StartIndex += BatchSize)
+	{
+		const int32 Count = FMath::Min(BatchSize, NumIterations - StartIndex);
+		if (bForceSync) { StartSync(new FAsyncTask<FPCGExRangeTask>(this, StartIndex, nullptr, Count, RunIndex)); }
+		else { Start(new FAsyncTask<FPCGExRangeTask>(this, StartIndex, nullptr, Count, RunIndex)); }
+	}
+}
+
 bool FPCGExAsyncManager::IsAsyncWorkComplete() const
 {
 	FReadScopeLock ReadLock(ManagerLock);
@@ -39,3 +54,17 @@ void FPCGExAsyncManager::Reset()
 	NumStarted = 0;
 	NumCompleted = 0;
 }
+
+bool FPCGExRangeTask::ExecuteTask()
+{
+	bool bSuccess = true;
+	for (int i = 0; i < Count; i++)
+	{
+		PCGEX_ASYNC_CHECKPOINT
+
+		// Rewind the scratch arena after each index, as if each ran in its own task
+		FMemMark ScratchMark(GetScratch());
+		bSuccess = RunIndex(TaskIndex + i) && bSuccess;
+	}
+	return bSuccess;
+}
@@ -22,6 +22,8 @@ void UPCGExOrientSettings::PostEditChangeProperty(FPropertyChangedEvent& Propert
 }
 #endif
 
+PCGExData::EInit UPCGExOrientSettings::GetMainOutputInitMode() const { return PCGExData::EInit::CopyOnWrite; }
+
 PCGEX_INITIALIZE_ELEMENT(Orient)
 
 bool FPCGExOrientElement::Boot(FPCGContext* InContext) const
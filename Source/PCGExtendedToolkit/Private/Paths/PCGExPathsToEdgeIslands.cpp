@@ -3,6 +3,7 @@
 
 #include "Paths/PCGExPathsToEdgeIslands.h"
 
+#include "Data/PCGExClusterData.h"
 #include "Data/PCGExData.h"
 #include "Graph/PCGExFindEdgeIslands.h"
 
@@ -234,7 +235,8 @@ bool FPCGExPathsToEdgeIslandsElement::ExecuteInternal(FPCGContext* InContext) co
 			const int32 IslandSize = Pair.Value;
 			if (IslandSize == -1) { continue; }
 
-			PCGExData::FPointIO& IslandIO = Context->IslandsIO->Emplace_GetRef(PCGExData::EInit::NewOutput);
+			PCGExData::FPointIO& IslandIO = Context->IslandsIO->Emplace_GetRef(PCGExData::EInit::NoOutput);
+			IslandIO.InitializeOutput<UPCGExClusterEdgesData>(PCGExData::EInit::NewOutput);
 			Context->Markings->Add(IslandIO);
 
 			Context->GetAsyncManager()->Start<FWriteIslandTask>(Pair.Key, Context->ConsolidatedPoints, &IslandIO, Context->EdgeNetwork);
@@ -0,0 +1,255 @@
+﻿// Copyright Timothé Lapetite 2023
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Paths/PCGExSimplify.h"
+
+#define LOCTEXT_NAMESPACE "PCGExSimplifyElement"
+#define PCGEX_NAMESPACE Simplify
+
+namespace PCGExSimplify
+{
+	struct FAreaCandidate
+	{
+		double Area;
+		int32 Index;
+
+		FAreaCandidate(const double InArea, const int32 InIndex)
+			: Area(InArea), Index(InIndex)
+		{
+		}
+
+		// Min-heap on area, so the least significant point is on top
+		bool operator<(const FAreaCandidate& Other) const { return Area < Other.Area; }
+	};
+
+	struct FSegmentCandidate
+	{
+		double DistSquared;
+		int32 Start;
+		int32 End;
+		int32 Farthest;
+
+		FSegmentCandidate(const double InDistSquared, const int32 InStart, const int32 InEnd, const int32 InFarthest)
+			: DistSquared(InDistSquared), Start(InStart), End(InEnd), Farthest(InFarthest)
+		{
+		}
+
+		// Max-heap on distance, so the segment with the largest error is on top
+		bool operator<(const FSegmentCandidate& Other) const { return DistSquared > Other.DistSquared; }
+	};
+
+	static double TriangleArea(const FVector& A, const FVector& B, const FVector& C)
+	{
+		return FVector::CrossProduct(B - A, C - A).Size() * 0.5;
+	}
+
+	/**
+	 * Visvalingam-Whyatt, O(n log n).
+	 * Points are removed by increasing effective area; a point's area never drops below the area of a point removed before it,
+	 * so removal order stays monotonic.
+	 */
+	static void VisvalingamWhyatt(const TConstArrayView<FVector>& Positions, const double MaxArea, const int32 MaxCount, TArrayView<bool> OutKeep)
+	{
+		const int32 NumPoints = Positions.Num();
+		const int32 LastIndex = NumPoints - 1;
+
+		PCGExMT::TScratchArray<int32> Prev;
+		PCGExMT::TScratchArray<int32> Next;
+		PCGExMT::TScratchArray<double> Areas;
+		PCGExMT::TScratchArray<FAreaCandidate> Heap;
+
+		Prev.SetNumUninitialized(NumPoints);
+		Next.SetNumUninitialized(NumPoints);
+		Areas.SetNumUninitialized(NumPoints);
+		Heap.Reserve(NumPoints);
+
+		for (int i = 0; i < NumPoints; i++)
+		{
+			OutKeep[i] = true;
+			Prev[i] = i - 1;
+			Next[i] = i + 1;
+		}
+
+		for (int i = 1; i < LastIndex; i++)
+		{
+			Areas[i] = TriangleArea(Positions[i - 1], Positions[i], Positions[i + 1]);
+			Heap.Add(FAreaCandidate(Areas[i], i));
+		}
+
+		Heap.Heapify();
+
+		int32 Remaining = NumPoints;
+		while (Remaining > 2 && !Heap.IsEmpty())
+		{
+			FAreaCandidate Candidate = Heap.HeapTop();
+			Heap.HeapPopDiscard(false);
+
+			// Stale entry, the point was removed or its area updated since
+			if (!OutKeep[Candidate.Index] || Candidate.Area != Areas[Candidate.Index]) { continue; }
+			if (Candidate.Area > MaxArea && Remaining <= MaxCount) { break; }
+
+			OutKeep[Candidate.Index] = false;
+			Remaining--;
+
+			const int32 P = Prev[Candidate.Index];
+			const int32 N = Next[Candidate.Index];
+			Next[P] = N;
+			Prev[N] = P;
+
+			if (P > 0)
+			{
+				Areas[P] = FMath::Max(Candidate.Area, TriangleArea(Positions[Prev[P]], Positions[P], Positions[N]));
+				Heap.HeapPush(FAreaCandidate(Areas[P], P));
+			}
+
+			if (N < LastIndex)
+			{
+				Areas[N] = FMath::Max(Candidate.Area, TriangleArea(Positions[P], Positions[N], Positions[Next[N]]));
+				Heap.HeapPush(FAreaCandidate(Areas[N], N));
+			}
+		}
+	}
+
+	static FSegmentCandidate FindFarthest(const TConstArrayView<FVector>& Positions, const int32 Start, const int32 End)
+	{
+		FSegmentCandidate Candidate(-1, Start, End, -1);
+		for (int i = Start + 1; i < End; i++)
+		{
+			const double DistSquared = FMath::PointDistToSegmentSquared(Positions[i], Positions[Start], Positions[End]);
+			if (DistSquared > Candidate.DistSquared)
+			{
+				Candidate.DistSquared = DistSquared;
+				Candidate.Farthest = i;
+			}
+		}
+		return Candidate;
+	}
+
+	/**
+	 * Douglas-Peucker, refining the segment with the largest error first.
+	 * This makes the point budget meaningful : the kept points are the MaxCount most significant ones.
+	 */
+	static void DouglasPeucker(const TConstArrayView<FVector>& Positions, const double MaxDistSquared, const int32 MaxCount, TArrayView<bool> OutKeep)
+	{
+		const int32 NumPoints = Positions.Num();
+		const int32 LastIndex = NumPoints - 1;
+
+		for (int i = 0; i < NumPoints; i++) { OutKeep[i] = false; }
+		OutKeep[0] = OutKeep[LastIndex] = true;
+
+		PCGExMT::TScratchArray<FSegmentCandidate> Heap;
+		Heap.HeapPush(FindFarthest(Positions, 0, LastIndex));
+
+		int32 Kept = 2;
+		while (Kept < MaxCount && !Heap.IsEmpty())
+		{
+			const FSegmentCandidate Segment = Heap.HeapTop();
+			Heap.HeapPopDiscard(false);
+
+			if (Segment.Farthest == -1 || Segment.DistSquared <= MaxDistSquared) { break; }
+
+			OutKeep[Segment.Farthest] = true;
+			Kept++;
+
+			if (Segment.Farthest - Segment.Start > 1) { Heap.HeapPush(FindFarthest(Positions, Segment.Start, Segment.Farthest)); }
+			if (Segment.End - Segment.Farthest > 1) { Heap.HeapPush(FindFarthest(Positions, Segment.Farthest, Segment.End)); }
+		}
+	}
+}
+
+UPCGExSimplifySettings::UPCGExSimplifySettings(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+}
+
+PCGExData::EInit UPCGExSimplifySettings::GetMainOutputInitMode() const { return PCGExData::EInit::NewOutput; }
+
+PCGEX_INITIALIZE_ELEMENT(Simplify)
+
+FPCGExSimplifyContext::~FPCGExSimplifyContext()
+{
+	PCGEX_TERMINATE_ASYNC
+}
+
+bool FPCGExSimplifyElement::Boot(FPCGContext* InContext) const
+{
+	if (!FPCGExPathProcessorElement::Boot(InContext)) { return false; }
+
+	PCGEX_CONTEXT_AND_SETTINGS(Simplify)
+
+	PCGEX_FWD(Method)
+	PCGEX_FWD(Tolerance)
+
+	Context->TargetPointCount = Settings->bUseTargetPointCount ? FMath::Max(2, Settings->TargetPointCount) : TNumericLimits<int32>::Max();
+
+	return true;
+}
+
+bool FPCGExSimplifyElement::ExecuteInternal(FPCGContext* InContext) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FPCGExSimplifyElement::Execute);
+
+	PCGEX_CONTEXT(Simplify)
+
+	if (Context->IsSetup())
+	{
+		if (!Boot(Context)) { return true; }
+		Context->SetState(PCGExMT::State_ReadyForNextPoints);
+	}
+
+	if (Context->IsState(PCGExMT::State_ReadyForNextPoints))
+	{
+		int32 Index = 0;
+		while (Context->AdvancePointsIO()) { Context->GetAsyncManager()->Start<FPCGExSimplifyTask>(Index++, Context->CurrentIO); }
+		Context->SetAsyncState(PCGExMT::State_WaitingOnAsyncWork);
+	}
+
+	if (Context->IsState(PCGExMT::State_WaitingOnAsyncWork))
+	{
+		if (Context->IsAsyncWorkComplete()) { Context->Done(); }
+	}
+
+	if (Context->IsDone())
+	{
+		Context->OutputPoints();
+	}
+
+	return Context->IsDone();
+}
+
+bool FPCGExSimplifyTask::ExecuteTask()
+{
+	const FPCGExSimplifyContext* Context = Manager->GetContext<FPCGExSimplifyContext>();
+
+	const TArray<FPCGPoint>& InPoints = PointIO->GetIn()->GetPoints();
+	TArray<FPCGPoint>& OutPoints = PointIO->GetOut()->GetMutablePoints();
+	const int32 NumPoints = InPoints.Num();
+
+	if (NumPoints <= 2)
+	{
+		OutPoints.Append(InPoints);
+		return true;
+	}
+
+	PCGExMT::TScratchArray<FVector> Positions;
+	PCGExMT::TScratchArray<bool> Keep;
+	Positions.SetNumUninitialized(NumPoints);
+	Keep.SetNumUninitialized(NumPoints);
+
+	for (int i = 0; i < NumPoints; i++) { Positions[i] = InPoints[i].Transform.GetLocation(); }
+
+	const double SquaredTolerance = Context->Tolerance * Context->Tolerance;
+
+	if (Context->Method == EPCGExSimplifyMethod::VisvalingamWhyatt) { PCGExSimplify::VisvalingamWhyatt(Positions, SquaredTolerance, Context->TargetPointCount, Keep); }
+	else { PCGExSimplify::DouglasPeucker(Positions, SquaredTolerance, Context->TargetPointCount, Keep); }
+
+	// Kept points are copied as-is, metadata entries included, so their attributes carry over.
+	OutPoints.Reserve(NumPoints);
+	for (int i = 0; i < NumPoints; i++) { if (Keep[i]) { OutPoints.Add(InPoints[i]); } }
+	OutPoints.Shrink();
+
+	return true;
+}
+
+#undef LOCTEXT_NAMESPACE
+#undef PCGEX_NAMESPACE
@@ -3,6 +3,7 @@
 
 #include "Paths/PCGExSubdivide.h"
 
+#include "Async/ParallelFor.h"
 #include "Paths/SubPoints/DataBlending/PCGExSubPointsBlendInterpolate.h"
 
 #define LOCTEXT_NAMESPACE "PCGExSubdivideElement"
@@ -72,60 +73,98 @@ bool FPCGExSubdivideElement::ExecuteInternal(FPCGContext* InContext) const
 
 	if (Context->IsState(PCGExMT::State_ProcessingPoints))
 	{
-		auto Initialize = [&](const PCGExData::FPointIO& PointIO)
-		{
-			Context->Milestones.Empty();
-			Context->Milestones.Add(0);
-			Context->MilestonesMetrics.Empty();
-			Context->MilestonesMetrics.Add(PCGExMath::FPathMetrics{});
-			if (Context->bFlagSubPoints) { Context->FlagAttribute = PointIO.GetOut()->Metadata->FindOrCreateAttribute(Context->FlagName, false, false); }
-		};
+		const PCGExData::FPointIO& PointIO = *Context->CurrentIO;
+		const TArray<FPCGPoint>& InPoints = PointIO.GetIn()->GetPoints();
+		const int32 NumPoints = InPoints.Num();
+		const bool bParallel = Context->bDoAsyncProcessing;
 
-		auto ProcessPoint = [&](const int32 Index, const PCGExData::FPointIO& PointIO)
+		if (NumPoints == 0)
 		{
-			int32 LastIndex;
+			Context->SetState(PCGExMT::State_ReadyForNextPoints);
+			return false;
+		}
 
-			const FPCGPoint& StartPoint = PointIO.GetInPoint(Index);
-			const FPCGPoint* EndPtr = PointIO.TryGetInPoint(Index + 1);
-			PointIO.CopyPoint(StartPoint, LastIndex);
+		if (Context->bFlagSubPoints) { Context->FlagAttribute = PointIO.GetOut()->Metadata->FindOrCreateAttribute(Context->FlagName, false, false); }
 
-			if (!EndPtr) { return; }
+		// Count subdivisions first so each segment knows where its points go
 
-			const FVector StartPos = StartPoint.Transform.GetLocation();
-			const FVector EndPos = EndPtr->Transform.GetLocation();
-			const FVector Dir = (EndPos - StartPos).GetSafeNormal();
-			PCGExMath::FPathMetrics& Metrics = Context->MilestonesMetrics.Last();
+		TArray<int32> NumSubdivisions;
+		NumSubdivisions.SetNumZeroed(NumPoints);
 
-			const double Distance = FVector::Distance(StartPos, EndPos);
-			const int32 NumSubdivisions = Context->SubdivideMethod == EPCGExSubdivideMode::Count ?
-				                              Context->Count :
-				                              FMath::Floor(FVector::Distance(StartPos, EndPos) / Context->Distance);
+		ParallelFor(
+			NumPoints - 1, [&](const int32 Index)
+			{
+				NumSubdivisions[Index] = Context->SubdivideMethod == EPCGExSubdivideMode::Count ?
+					                         Context->Count :
+					                         FMath::Floor(FVector::Distance(InPoints[Index].Transform.GetLocation(), InPoints[Index + 1].Transform.GetLocation()) / Context->Distance);
+			}, !bParallel);
 
-			const double StepSize = Distance / static_cast<double>(NumSubdivisions);
-			const double StartOffset = (Distance - StepSize * NumSubdivisions) * 0.5;
+		TArray<int32> StartIndices;
+		StartIndices.SetNumUninitialized(NumPoints);
 
-			Metrics.Reset(StartPos);
+		int32 NumOutPoints = 0;
+		for (int i = 0; i < NumPoints; i++)
+		{
+			StartIndices[i] = NumOutPoints;
+			NumOutPoints += 1 + NumSubdivisions[i];
+		}
+
+		const int32 FirstIndex = PointIO.AddPoints(NumOutPoints);
+		TArray<FPCGPoint>& MutablePoints = PointIO.GetOut()->GetMutablePoints();
 
-			for (int i = 0; i < NumSubdivisions; i++)
+		Context->Milestones.SetNumUninitialized(NumPoints);
+		Context->Milestones[0] = FirstIndex;
+		Context->MilestonesMetrics.Empty();
+		Context->MilestonesMetrics.SetNum(NumPoints);
+
+		ParallelFor(
+			NumPoints, [&](const int32 Index)
 			{
-				FPCGPoint& NewPoint = PointIO.CopyPoint(StartPoint, LastIndex);
-				FVector SubLocation = StartPos + Dir * (StartOffset + i * StepSize);
-				NewPoint.Transform.SetLocation(SubLocation);
-				Metrics.Add(SubLocation);
+				const FPCGPoint& StartPoint = InPoints[Index];
+				const int32 StartIndex = FirstIndex + StartIndices[Index];
+				MutablePoints[StartIndex] = StartPoint;
 
-				if (Context->FlagAttribute) { Context->FlagAttribute->SetValue(NewPoint.MetadataEntry, true); }
-			}
+				if (Index == NumPoints - 1) { return; }
 
-			Metrics.Add(EndPos);
+				const FVector StartPos = StartPoint.Transform.GetLocation();
+				const FVector EndPos = InPoints[Index + 1].Transform.GetLocation();
+				const FVector Dir = (EndPos - StartPos).GetSafeNormal();
+				PCGExMath::FPathMetrics& Metrics = Context->MilestonesMetrics[Index];
 
-			Context->Milestones.Add(LastIndex);
-			Context->MilestonesMetrics.Emplace_GetRef();
-		};
+				const double Distance = FVector::Distance(StartPos, EndPos);
+				const int32 NumSubPoints = NumSubdivisions[Index];
+
+				const double StepSize = Distance / static_cast<double>(NumSubPoints);
+				const double StartOffset = (Distance - StepSize * NumSubPoints) * 0.5;
+
+				Metrics.Reset(StartPos);
+
+				for (int i = 0; i < NumSubPoints; i++)
+				{
+					FPCGPoint& NewPoint = MutablePoints[StartIndex + 1 + i];
+					NewPoint = StartPoint;
+					FVector SubLocation = StartPos + Dir * (StartOffset + i * StepSize);
+					NewPoint.Transform.SetLocation(SubLocation);
+					Metrics.Add(SubLocation);
+				}
+
+				Metrics.Add(EndPos);
 
-		if (Context->ProcessCurrentPoints(Initialize, ProcessPoint, true))
+				Context->Milestones[Index + 1] = StartIndex + NumSubPoints;
+			}, !bParallel);
+
+		PointIO.InitPoints(FirstIndex, NumOutPoints, bParallel);
+
+		if (Context->FlagAttribute)
 		{
-			Context->SetState(PCGExSubdivide::State_BlendingPoints);
+			for (int i = 0; i < NumPoints; i++)
+			{
+				const int32 StartIndex = FirstIndex + StartIndices[i];
+				for (int j = 1; j <= NumSubdivisions[i]; j++) { Context->FlagAttribute->SetValue(MutablePoints[StartIndex + j].MetadataEntry, true); }
+			}
 		}
+
+		Context->SetState(PCGExSubdivide::State_BlendingPoints);
 	}
 
 	if (Context->IsState(PCGExSubdivide::State_BlendingPoints))
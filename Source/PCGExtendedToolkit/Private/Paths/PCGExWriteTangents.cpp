@@ -22,6 +22,8 @@ void UPCGExWriteTangentsSettings::PostEditChangeProperty(FPropertyChangedEvent&
 }
 #endif
 
+PCGExData::EInit UPCGExWriteTangentsSettings::GetMainOutputInitMode() const { return PCGExData::EInit::CopyOnWrite; }
+
 PCGEX_INITIALIZE_ELEMENT(WriteTangents)
 
 FPCGExWriteTangentsContext::~FPCGExWriteTangentsContext()
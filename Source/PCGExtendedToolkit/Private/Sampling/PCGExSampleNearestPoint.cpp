@@ -95,6 +95,9 @@ bool FPCGExSampleNearestPointElement::Boot(FPCGContext* InContext) const
 		return false;
 	}
 
+	// Build target positions upfront so tasks don't wait on each other for it
+	Context->Targets->GetInPointsCache(PCGExData::EPointsCache::Positions);
+
 	if (!Context->WeightCurve)
 	{
 		PCGE_LOG(Error, GraphAndLog, FTEXT("Weight Curve asset could not be loaded."));
@@ -157,12 +160,9 @@ bool FPCGExSampleNearestPointElement::ExecuteInternal(FPCGContext* InContext) co
 			PCGEX_SAMPLENEARESTPOINT_FOREACH(PCGEX_OUTPUT_ACCESSOR_INIT)
 		};
 
-		auto ProcessPoint = [&](const int32 ReadIndex, const PCGExData::FPointIO& PointIO)
-		{
-			Context->GetAsyncManager()->Start<FSamplePointTask>(ReadIndex, const_cast<PCGExData::FPointIO*>(&PointIO));
-		};
-
-		if (Context->ProcessCurrentPoints(Initialize, ProcessPoint)) { Context->SetAsyncState(PCGExMT::State_WaitingOnAsyncWork); }
+		Initialize(*Context->CurrentIO);
+		Context->GetAsyncManager()->StartRanges<FSamplePointTask>(Context->CurrentIO->GetNum(), Context->ChunkSize, Context->CurrentIO);
+		Context->SetAsyncState(PCGExMT::State_WaitingOnAsyncWork);
 	}
 
 	if (Context->IsState(PCGExMT::State_WaitingOnAsyncWork))
@@ -191,41 +191,52 @@ bool FSamplePointTask::ExecuteTask()
 
 	if (RangeMin > RangeMax) { std::swap(RangeMin, RangeMax); }
 
-	TArray<PCGExNearestPoint::FTargetInfos> TargetsInfos;
+	PCGExMT::TScratchArray<PCGExNearestPoint::FTargetInfos> TargetsInfos;
 	TargetsInfos.Reserve(Context->Targets->GetNum());
 
+	const PCGExData::FPointsCache& TargetsCache = Context->Targets->GetInPointsCache(PCGExData::EPointsCache::Positions);
+	const TConstArrayView<double> TargetsX = TargetsCache.GetX();
+	const TConstArrayView<double> TargetsY = TargetsCache.GetY();
+	const TConstArrayView<double> TargetsZ = TargetsCache.GetZ();
+
 	PCGExNearestPoint::FTargetsCompoundInfos TargetsCompoundInfos;
-	auto ProcessTarget = [&](const PCGEx::FPointRef& Target)
+	auto ProcessTarget = [&](const int32 TargetIndex, const double Dist)
 	{
-		const double Dist = FVector::DistSquared(Origin, Target.Point->Transform.GetLocation());
-
 		if (RangeMax > 0 && (Dist < RangeMin || Dist > RangeMax)) { return; }
 
 		if (Context->SampleMethod == EPCGExSampleMethod::ClosestTarget ||
 			Context->SampleMethod == EPCGExSampleMethod::FarthestTarget)
 		{
-			TargetsCompoundInfos.UpdateCompound(PCGExNearestPoint::FTargetInfos(Target.Index, Dist));
+			TargetsCompoundInfos.UpdateCompound(PCGExNearestPoint::FTargetInfos(TargetIndex, Dist));
 		}
 		else
 		{
-			const PCGExNearestPoint::FTargetInfos& Infos = TargetsInfos.Emplace_GetRef(Target.Index, Dist);
+			const PCGExNearestPoint::FTargetInfos& Infos = TargetsInfos.Emplace_GetRef(TargetIndex, Dist);
 			TargetsCompoundInfos.UpdateCompound(Infos);
 		}
 	};
 
 	if (RangeMax > 0)
 	{
-		const FBox Box = FBoxCenterAndExtent(Origin, FVector(FMath::Sqrt(RangeMax))).GetBox();
+		const double Range = FMath::Sqrt(RangeMax);
 		for (int i = 0; i < NumTargets; i++)
 		{
-			const FPCGPoint& Target = Context->Targets->GetInPoint(i);
-			//TODO: Target locations can be cached
-			if (Box.IsInside(Target.Transform.GetLocation())) { ProcessTarget(PCGEx::FPointRef(Target, i)); }
+			const double DX = TargetsX[i] - Origin.X;
+			const double DY = TargetsY[i] - Origin.Y;
+			const double DZ = TargetsZ[i] - Origin.Z;
+			if (FMath::Abs(DX) > Range || FMath::Abs(DY) > Range || FMath::Abs(DZ) > Range) { continue; }
+			ProcessTarget(i, DX * DX + DY * DY + DZ * DZ);
 		}
 	}
 	else
 	{
-		for (int i = 0; i < NumTargets; i++) { ProcessTarget(Context->Targets->GetInPointRef(i)); }
+		for (int i = 0; i < NumTargets; i++)
+		{
+			const double DX = TargetsX[i] - Origin.X;
+			const double DY = TargetsY[i] - Origin.Y;
+			const double DZ = TargetsZ[i] - Origin.Z;
+			ProcessTarget(i, DX * DX + DY * DY + DZ * DZ);
+		}
 	}
 
 	// Compound never got updated, meaning we couldn't find target in range
@@ -252,7 +263,7 @@ bool FSamplePointTask::ExecuteTask()
 		(const PCGExNearestPoint::FTargetInfos& TargetInfos, const double Weight)
 	{
 		const FPCGPoint& Target = Context->Targets->GetInPoint(TargetInfos.Index);
-		const FVector TargetLocationOffset = Target.Transform.GetLocation() - Origin;
+		const FVector TargetLocationOffset = TargetsCache.GetPosition(TargetInfos.Index) - Origin;
 
 		WeightedLocation += (TargetLocationOffset * Weight); // Relative to origin
 		WeightedLookAt += (TargetLocationOffset.GetSafeNormal()) * Weight;
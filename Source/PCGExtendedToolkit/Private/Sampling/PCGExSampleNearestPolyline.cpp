@@ -143,12 +143,9 @@ bool FPCGExSampleNearestPolylineElement::ExecuteInternal(FPCGContext* InContext)
 			PCGEX_SAMPLENEARESTPOLYLINE_FOREACH(PCGEX_OUTPUT_ACCESSOR_INIT)
 		};
 
-		auto ProcessPoint = [&](const int32 PointIndex, const PCGExData::FPointIO& PointIO)
-		{
-			Context->GetAsyncManager()->Start<FSamplePolylineTask>(PointIndex, Context->CurrentIO);
-		};
-
-		if (Context->ProcessCurrentPoints(Initialize, ProcessPoint)) { Context->SetAsyncState(PCGExMT::State_WaitingOnAsyncWork); }
+		Initialize(*Context->CurrentIO);
+		Context->GetAsyncManager()->StartRanges<FSamplePolylineTask>(Context->CurrentIO->GetNum(), Context->ChunkSize, Context->CurrentIO);
+		Context->SetAsyncState(PCGExMT::State_WaitingOnAsyncWork);
 	}
 
 	if (Context->IsState(PCGExMT::State_WaitingOnAsyncWork))
@@ -176,7 +173,7 @@ bool FSamplePolylineTask::ExecuteTask()
 
 	if (RangeMin > RangeMax) { std::swap(RangeMin, RangeMax); }
 
-	TArray<PCGExPolyLine::FSampleInfos> TargetsInfos;
+	PCGExMT::TScratchArray<PCGExPolyLine::FSampleInfos> TargetsInfos;
 	TargetsInfos.Reserve(Context->NumTargets);
 
 	PCGExPolyLine::FTargetsCompoundInfos TargetsCompoundInfos;
@@ -83,12 +83,9 @@ bool FPCGExSampleSurfaceGuidedElement::ExecuteInternal(FPCGContext* InContext) c
 			PCGEX_SAMPLENEARESTTRACE_FOREACH(PCGEX_OUTPUT_ACCESSOR_INIT)
 		};
 
-		auto ProcessPoint = [&](const int32 PointIndex, const PCGExData::FPointIO& PointIO)
-		{
-			Context->GetAsyncManager()->Start<FTraceTask>(PointIndex, Context->CurrentIO);
-		};
-
-		if (Context->ProcessCurrentPoints(Initialize, ProcessPoint)) { Context->SetAsyncState(PCGExMT::State_WaitingOnAsyncWork); }
+		Initialize(*Context->CurrentIO);
+		Context->GetAsyncManager()->StartRanges<FTraceTask>(Context->CurrentIO->GetNum(), Context->ChunkSize, Context->CurrentIO);
+		Context->SetAsyncState(PCGExMT::State_WaitingOnAsyncWork);
 	}
 
 	if (Context->IsState(PCGExMT::State_WaitingOnAsyncWork))
@@ -0,0 +1,55 @@
+﻿// Copyright Timothé Lapetite 2023
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Misc/AutomationTest.h"
+
+#include "Data/PCGExPointIO.h"
+#include "Data/Blending/PCGExDataBlendingOperations.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExBlendRangeFromPrimaryTest, "PCGEx.Data.Blending.BlendRangeFromPrimary",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FPCGExBlendRangeFromPrimaryTest::RunTest(const FString& Parameters)
+{
+	const FName AttributeName = FName("Value");
+	const TArray<double> InValues = {0, 9, 9, 9, 4};
+
+	UPCGPointData* InData = NewObject<UPCGPointData>();
+	FPCGMetadataAttribute<double>* Attribute = InData->Metadata->CreateAttribute<double>(AttributeName, 0, true, true);
+
+	TArray<FPCGPoint>& Points = InData->GetMutablePoints();
+	for (const double Value : InValues)
+	{
+		FPCGPoint& Point = Points.Emplace_GetRef();
+		InData->Metadata->InitializeOnSet(Point.MetadataEntry);
+		Attribute->SetValue(Point.MetadataEntry, Value);
+	}
+
+	PCGExData::FPointIOGroup* Group = new PCGExData::FPointIOGroup();
+	PCGExData::FPointIO& PointIO = Group->Emplace_GetRef(InData, PCGExData::EInit::DuplicateInput);
+
+	// Blend the whole data from its first to its last point, the way sub-points blending does.
+	// Five values go through both the 4-wide SIMD path and the scalar tail.
+
+	PCGExDataBlending::FDataBlendingWeight<double>* Op = new PCGExDataBlending::FDataBlendingWeight<double>();
+	Op->SetAttributeName(AttributeName);
+	Op->PrepareForData(PointIO, PointIO, true);
+
+	TArray<double> Alphas = {0.25, 0.5, 0.75, 0.5, 0.5};
+	Op->DoRangeOperation(0, 4, 0, InValues.Num(), MakeArrayView(Alphas));
+
+	const TArray<double> Expected = {1, 2, 3, 2, 2};
+	for (int i = 0; i < Expected.Num(); i++)
+	{
+		TestEqual(FString::Printf(TEXT("Value %d is blended from the original primary value"), i), Op->GetPrimaryValue(i), Expected[i]);
+	}
+
+	delete Op;
+	delete Group;
+	return true;
+}
+
+#endif
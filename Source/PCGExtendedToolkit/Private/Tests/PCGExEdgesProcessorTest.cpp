@@ -0,0 +1,95 @@
+﻿// Copyright Timothé Lapetite 2023
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Misc/AutomationTest.h"
+
+#include "Graph/PCGExEdgesProcessor.h"
+#include "Graph/PCGExEdge.h"
+#include "Graph/PCGExMesh.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace PCGExEdgesProcessorTest
+{
+	static UPCGPointData* MakeVertices(const int32 PUID, const int32 NumPoints)
+	{
+		UPCGPointData* Data = NewObject<UPCGPointData>();
+		TArray<FPCGPoint>& Points = Data->GetMutablePoints();
+		for (int i = 0; i < NumPoints; i++) { Points.Emplace_GetRef().Transform.SetLocation(FVector(i * 100, PUID * 100, 0)); }
+		PCGExData::WriteMark<int32>(Data->Metadata, PCGExGraph::PUIDAttributeName, PUID);
+		return Data;
+	}
+
+	static UPCGPointData* MakeEdges(const int32 PUID, const TArray<FIntPoint>& Edges)
+	{
+		UPCGPointData* Data = NewObject<UPCGPointData>();
+		FPCGMetadataAttribute<int32>* StartAttribute = Data->Metadata->CreateAttribute<int32>(PCGExGraph::EdgeStartAttributeName, -1, false, true);
+		FPCGMetadataAttribute<int32>* EndAttribute = Data->Metadata->CreateAttribute<int32>(PCGExGraph::EdgeEndAttributeName, -1, false, true);
+
+		TArray<FPCGPoint>& Points = Data->GetMutablePoints();
+		for (const FIntPoint& Edge : Edges)
+		{
+			FPCGPoint& Point = Points.Emplace_GetRef();
+			Data->Metadata->InitializeOnSet(Point.MetadataEntry);
+			StartAttribute->SetValue(Point.MetadataEntry, Edge.X);
+			EndAttribute->SetValue(Point.MetadataEntry, Edge.Y);
+		}
+
+		PCGExData::WriteMark<int32>(Data->Metadata, PCGExGraph::PUIDAttributeName, PUID);
+		return Data;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExAdvanceEdgesMultipleClustersTest, "PCGEx.Graph.EdgesProcessor.AdvanceEdgesMultipleClusters",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FPCGExAdvanceEdgesMultipleClustersTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExEdgesProcessorTest;
+
+	FPCGExEdgesProcessorContext* Context = new FPCGExEdgesProcessorContext();
+	Context->MainPoints = new PCGExData::FPointIOGroup();
+	Context->Edges = new PCGExData::FPointIOGroup();
+
+	// Two clusters, with their edges inputs interleaved; cluster B has fewer vertices than A's edges refer to
+
+	const PCGExData::FPointIO& VerticesA = Context->MainPoints->Emplace_GetRef(MakeVertices(1, 3));
+	const PCGExData::FPointIO& VerticesB = Context->MainPoints->Emplace_GetRef(MakeVertices(2, 2));
+
+	const PCGExData::FPointIO& EdgesA0 = Context->Edges->Emplace_GetRef(MakeEdges(1, {FIntPoint(0, 1), FIntPoint(1, 2)}));
+	const PCGExData::FPointIO& EdgesB = Context->Edges->Emplace_GetRef(MakeEdges(2, {FIntPoint(0, 1)}));
+	const PCGExData::FPointIO& EdgesA1 = Context->Edges->Emplace_GetRef(MakeEdges(1, {FIntPoint(0, 2)}));
+
+	TArray<const PCGExData::FPointIO*> Visited;
+
+	TestTrue(TEXT("Advance to cluster A"), Context->AdvanceAndBindPointsIO());
+	TestTrue(TEXT("Current points are cluster A"), Context->CurrentIO == &VerticesA);
+	while (Context->AdvanceEdges())
+	{
+		Visited.Add(Context->CurrentEdges);
+		TestFalse(TEXT("Cluster A edges are valid against cluster A vertices"), Context->CurrentMesh->HasInvalidEdges());
+	}
+	TestEqual(TEXT("Cluster A visits its two edges inputs"), Visited.Num(), 2);
+	TestTrue(TEXT("Cluster A visits its first edges"), Visited.Contains(&EdgesA0));
+	TestTrue(TEXT("Cluster A visits its second edges"), Visited.Contains(&EdgesA1));
+
+	Visited.Reset();
+
+	TestTrue(TEXT("Advance to cluster B"), Context->AdvanceAndBindPointsIO());
+	TestTrue(TEXT("Current points are cluster B"), Context->CurrentIO == &VerticesB);
+	while (Context->AdvanceEdges())
+	{
+		Visited.Add(Context->CurrentEdges);
+		TestFalse(TEXT("Cluster B edges are valid against cluster B vertices"), Context->CurrentMesh->HasInvalidEdges());
+	}
+	TestEqual(TEXT("Cluster B only visits its own edges"), Visited.Num(), 1);
+	TestTrue(TEXT("Cluster B visits its edges"), Visited.Contains(&EdgesB));
+
+	TestFalse(TEXT("No more clusters"), Context->AdvanceAndBindPointsIO());
+
+	delete Context;
+	return true;
+}
+
+#endif
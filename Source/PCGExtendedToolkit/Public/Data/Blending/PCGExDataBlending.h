@@ -161,6 +161,9 @@ namespace PCGExDataBlending
 
 		virtual void FullBlendToOne(const TArrayView<double>& Alphas) const;
 
+		/** Successively blend secondary values [StartIndex, StartIndex + Count[ into the primary value at WriteIndex */
+		virtual void DoRangeIntoOperation(const int32 WriteIndex, const int32 StartIndex, const int32 Count, const TArrayView<double>& Alphas) const;
+
 		virtual void ResetToDefault(int32 WriteIndex) const;
 		virtual void ResetRangeToDefault(int32 StartIndex, int32 Count) const;
 
@@ -240,9 +243,10 @@ namespace PCGExDataBlending
 		{
 			if (bInterpolationAllowed)
 			{
+				// Copies, the range may start with the primary value itself
 				const T A = (*Writer)[PrimaryReadIndex];
 				const T B = (*Reader)[SecondaryReadIndex];
-				for (int i = 0; i < Values.Num(); i++) { Values[i] = SingleOperation(A, B, Alphas[i]); }
+				BlendValuesRange(A, B, Values, Alphas);
 			}
 			else
 			{
@@ -261,7 +265,50 @@ namespace PCGExDataBlending
 		virtual void FullBlendToOne(const TArrayView<double>& Alphas) const override
 		{
 			if (!bInterpolationAllowed) { return; }
-			for (int i = 0; i < Writer->Values.Num(); i++) { Writer->Values[i] = SingleOperation(Writer->Values[i], Reader->Values[i], Alphas[i]); }
+			TArrayView<T> Values = MakeArrayView(Writer->Values);
+			BlendValuesEach(Values, MakeArrayView(Reader->GetValues()), Alphas);
+		}
+
+		/**
+		 * Values[i] = SingleOperation(A, B, Alphas[i]) over the whole range.
+		 * Operations override this with a range kernel so there is one virtual call per range rather than one per value.
+		 */
+		virtual void BlendValuesRange(const T& A, const T& B, TArrayView<T>& Values, const TArrayView<double>& Alphas) const
+		{
+			for (int i = 0; i < Values.Num(); i++) { Values[i] = SingleOperation(A, B, Alphas[i]); }
+		}
+
+		/** Values[i] = SingleOperation(Values[i], Others[i], Alphas[i]) over the whole range. */
+		virtual void BlendValuesEach(TArrayView<T>& Values, const TConstArrayView<T>& Others, const TArrayView<double>& Alphas) const
+		{
+			for (int i = 0; i < Values.Num(); i++) { Values[i] = SingleOperation(Values[i], Others[i], Alphas[i]); }
+		}
+
+		/** Value = SingleOperation(Value, Others[i], Alphas[i]) for each value of the range, in order. */
+		virtual void BlendValuesInto(T& Value, const TConstArrayView<T>& Others, const TArrayView<double>& Alphas) const
+		{
+			for (int i = 0; i < Others.Num(); i++) { Value = SingleOperation(Value, Others[i], Alphas[i]); }
+		}
+
+		virtual void DoRangeIntoOperation(const int32 WriteIndex, const int32 StartIndex, const int32 Count, const TArrayView<double>& Alphas) const override
+		{
+			if (!bInterpolationAllowed) { return; }
+			BlendValuesInto(Writer->Values[WriteIndex], MakeArrayView(Reader->GetValues().GetData() + StartIndex, Count), Alphas);
+		}
+
+		virtual void PrepareOperation(const int32 WriteIndex) const override { SinglePrepare(Writer->Values[WriteIndex]); }
+
+		virtual void DoOperation(const int32 PrimaryReadIndex, const int32 SecondaryReadIndex, const int32 WriteIndex, const double Alpha = 0) const override
+		{
+			Writer->Values[WriteIndex] = bInterpolationAllowed ?
+				                             SingleOperation((*Writer)[PrimaryReadIndex], (*Reader)[SecondaryReadIndex], Alpha) :
+				                             (*Writer)[PrimaryReadIndex];
+		}
+
+		virtual void FinalizeOperation(const int32 WriteIndex, const double Alpha) const override
+		{
+			if (!bInterpolationAllowed) { return; }
+			SingleFinalize(Writer->Values[WriteIndex], Alpha);
 		}
 
 		virtual void SinglePrepare(T& A) const
@@ -514,5 +561,156 @@ namespace PCGExDataBlending
 	template <typename T>
 	static T NoBlend(const T& A, const T& B, const double& Alpha = 0) { return A; }
 
+#pragma endregion
+
+#pragma region Range kernels
+
+	// Range kernels blend a whole contiguous run of values in one go.
+	// double, float & FVector are processed with VectorRegister math, every other type falls back to the single-value helpers above.
+
+	template <typename T>
+	static constexpr bool IsSIMDScalar() { return std::is_same_v<T, double> || std::is_same_v<T, float>; }
+
+	template <typename T>
+	static auto MakeSIMDSplat(const double Value)
+	{
+		if constexpr (std::is_same_v<T, float>) { return MakeVectorRegisterFloat(static_cast<float>(Value), static_cast<float>(Value), static_cast<float>(Value), static_cast<float>(Value)); }
+		else { return MakeVectorRegisterDouble(Value, Value, Value, Value); }
+	}
+
+	/** Load 4 consecutive alphas into a register matching T's precision */
+	template <typename T>
+	static auto LoadSIMDAlphas(const double* Alphas)
+	{
+		if constexpr (std::is_same_v<T, float>) { return MakeVectorRegisterFloat(static_cast<float>(Alphas[0]), static_cast<float>(Alphas[1]), static_cast<float>(Alphas[2]), static_cast<float>(Alphas[3])); }
+		else { return VectorLoad(Alphas); }
+	}
+
+	template <typename T>
+	static void FillRange(TArrayView<T>& Values, const T& Value) { for (T& V : Values) { V = Value; } }
+
+	template <typename T>
+	static void CopyRange(TArrayView<T>& Values, const TConstArrayView<T>& Others)
+	{
+		if (Values.GetData() == Others.GetData()) { return; }
+		for (int i = 0; i < Values.Num(); i++) { Values[i] = Others[i]; }
+	}
+
+#define PCGEX_SIMD_RANGE_KERNEL(_NAME, _SINGLE, _VECTOR_OP)\
+	template <typename T>\
+	static void _NAME##Range(TArrayView<T>& Values, const TConstArrayView<T>& Others)\
+	{\
+		const int32 NumValues = Values.Num();\
+		int32 i = 0;\
+		if constexpr (IsSIMDScalar<T>())\
+		{\
+			T* Data = Values.GetData();\
+			const T* OtherData = Others.GetData();\
+			for (; i + 4 <= NumValues; i += 4) { VectorStore(_VECTOR_OP(VectorLoad(Data + i), VectorLoad(OtherData + i)), Data + i); }\
+		}\
+		else if constexpr (std::is_same_v<T, FVector>)\
+		{\
+			for (; i < NumValues; i++) { VectorStoreFloat3(_VECTOR_OP(VectorLoadFloat3(&Values[i].X), VectorLoadFloat3(&Others[i].X)), &Values[i].X); }\
+		}\
+		for (; i < NumValues; i++) { Values[i] = _SINGLE(Values[i], Others[i]); }\
+	}
+
+	/** Values[i] = Add(Values[i], Others[i]) */
+	PCGEX_SIMD_RANGE_KERNEL(Add, Add, VectorAdd)
+
+	/** Values[i] = Min(Values[i], Others[i]) */
+	PCGEX_SIMD_RANGE_KERNEL(Min, Min, VectorMin)
+
+	/** Values[i] = Max(Values[i], Others[i]) */
+	PCGEX_SIMD_RANGE_KERNEL(Max, Max, VectorMax)
+
+#undef PCGEX_SIMD_RANGE_KERNEL
+
+	/** Values[i] = Lerp(A, B, Alphas[i]) */
+	template <typename T>
+	static void LerpRange(TArrayView<T>& Values, const T& A, const T& B, const TArrayView<double>& Alphas)
+	{
+		const int32 NumValues = Values.Num();
+		int32 i = 0;
+		if constexpr (IsSIMDScalar<T>())
+		{
+			T* Data = Values.GetData();
+			const auto VA = MakeSIMDSplat<T>(A);
+			const auto VDelta = VectorSubtract(MakeSIMDSplat<T>(B), VA);
+			for (; i + 4 <= NumValues; i += 4) { VectorStore(VectorMultiplyAdd(LoadSIMDAlphas<T>(Alphas.GetData() + i), VDelta, VA), Data + i); }
+		}
+		else if constexpr (std::is_same_v<T, FVector>)
+		{
+			const VectorRegister4Double VA = VectorLoadFloat3(&A.X);
+			const VectorRegister4Double VDelta = VectorSubtract(VectorLoadFloat3(&B.X), VA);
+			for (; i < NumValues; i++) { VectorStoreFloat3(VectorMultiplyAdd(MakeSIMDSplat<double>(Alphas[i]), VDelta, VA), &Values[i].X); }
+		}
+		for (; i < NumValues; i++) { Values[i] = Lerp(A, B, Alphas[i]); }
+	}
+
+	/** Values[i] = Lerp(Values[i], Others[i], Alphas[i]) */
+	template <typename T>
+	static void LerpRange(TArrayView<T>& Values, const TConstArrayView<T>& Others, const TArrayView<double>& Alphas)
+	{
+		const int32 NumValues = Values.Num();
+		int32 i = 0;
+		if constexpr (IsSIMDScalar<T>())
+		{
+			T* Data = Values.GetData();
+			const T* OtherData = Others.GetData();
+			for (; i + 4 <= NumValues; i += 4)
+			{
+				const auto VA = VectorLoad(Data + i);
+				VectorStore(VectorMultiplyAdd(LoadSIMDAlphas<T>(Alphas.GetData() + i), VectorSubtract(VectorLoad(OtherData + i), VA), VA), Data + i);
+			}
+		}
+		else if constexpr (std::is_same_v<T, FVector>)
+		{
+			for (; i < NumValues; i++)
+			{
+				const VectorRegister4Double VA = VectorLoadFloat3(&Values[i].X);
+				VectorStoreFloat3(VectorMultiplyAdd(MakeSIMDSplat<double>(Alphas[i]), VectorSubtract(VectorLoadFloat3(&Others[i].X), VA), VA), &Values[i].X);
+			}
+		}
+		for (; i < NumValues; i++) { Values[i] = Lerp(Values[i], Others[i], Alphas[i]); }
+	}
+
+	/** Value = Add(Value, Others[i]) for each value */
+	template <typename T>
+	static void AddInto(T& Value, const TConstArrayView<T>& Others) { for (const T& Other : Others) { Value = Add(Value, Other); } }
+
+	/** Value = Min(Value, Others[i]) for each value */
+	template <typename T>
+	static void MinInto(T& Value, const TConstArrayView<T>& Others) { for (const T& Other : Others) { Value = Min(Value, Other); } }
+
+	/** Value = Max(Value, Others[i]) for each value */
+	template <typename T>
+	static void MaxInto(T& Value, const TConstArrayView<T>& Others) { for (const T& Other : Others) { Value = Max(Value, Other); } }
+
+	/** Value = Lerp(Value, Others[i], Alphas[i]) for each value, in order */
+	template <typename T>
+	static void LerpInto(T& Value, const TConstArrayView<T>& Others, const TArrayView<double>& Alphas)
+	{
+		for (int i = 0; i < Others.Num(); i++) { Value = Lerp(Value, Others[i], Alphas[i]); }
+	}
+
+	/** Values[i] = Div(Values[i], Dividers[i]) */
+	template <typename T>
+	static void DivRange(TArrayView<T>& Values, const TArrayView<double>& Dividers)
+	{
+		const int32 NumValues = Values.Num();
+		int32 i = 0;
+		if constexpr (IsSIMDScalar<T>())
+		{
+			T* Data = Values.GetData();
+			for (; i + 4 <= NumValues; i += 4) { VectorStore(VectorDivide(VectorLoad(Data + i), LoadSIMDAlphas<T>(Dividers.GetData() + i)), Data + i); }
+		}
+		else if constexpr (std::is_same_v<T, FVector>)
+		{
+			for (; i < NumValues; i++) { VectorStoreFloat3(VectorMultiply(VectorLoadFloat3(&Values[i].X), MakeSIMDSplat<double>(1 / Dividers[i])), &Values[i].X); }
+		}
+		for (; i < NumValues; i++) { Values[i] = Div(Values[i], Dividers[i]); }
+	}
+
 #pragma endregion
 }
@@ -18,6 +18,17 @@ namespace PCGExDataBlending
 		virtual void SinglePrepare(T& A) const override { A = this->Writer->GetDefaultValue(); }
 		virtual T SingleOperation(T A, T B, double Alpha) const override { return PCGExDataBlending::Add(A, B); }
 		virtual void SingleFinalize(T& A, double Alpha) const override { A = PCGExDataBlending::Div(A, Alpha); }
+
+		virtual void PrepareValuesRangeOperation(TArrayView<T>& Values, const int32 StartIndex) const override { PCGExDataBlending::FillRange(Values, this->Writer->GetDefaultValue()); }
+		virtual void BlendValuesRange(const T& A, const T& B, TArrayView<T>& Values, const TArrayView<double>& Alphas) const override { PCGExDataBlending::FillRange(Values, PCGExDataBlending::Add(A, B)); }
+		virtual void BlendValuesEach(TArrayView<T>& Values, const TConstArrayView<T>& Others, const TArrayView<double>& Alphas) const override { PCGExDataBlending::AddRange(Values, Others); }
+		virtual void BlendValuesInto(T& Value, const TConstArrayView<T>& Others, const TArrayView<double>& Alphas) const override { PCGExDataBlending::AddInto(Value, Others); }
+
+		virtual void FinalizeValuesRangeOperation(TArrayView<T>& Values, const TArrayView<double>& Alphas) const override
+		{
+			if (!this->bInterpolationAllowed) { return; }
+			PCGExDataBlending::DivRange(Values, Alphas);
+		}
 	};
 
 	template <typename T>
@@ -25,6 +36,10 @@ namespace PCGExDataBlending
 	{
 	public:
 		virtual T SingleOperation(T A, T B, double Alpha) const override { return B; }
+
+		virtual void BlendValuesRange(const T& A, const T& B, TArrayView<T>& Values, const TArrayView<double>& Alphas) const override { PCGExDataBlending::FillRange(Values, B); }
+		virtual void BlendValuesEach(TArrayView<T>& Values, const TConstArrayView<T>& Others, const TArrayView<double>& Alphas) const override { PCGExDataBlending::CopyRange(Values, Others); }
+		virtual void BlendValuesInto(T& Value, const TConstArrayView<T>& Others, const TArrayView<double>& Alphas) const override { if (!Others.IsEmpty()) { Value = Others.Last(); } }
 	};
 
 	template <typename T>
@@ -32,6 +47,10 @@ namespace PCGExDataBlending
 	{
 	public:
 		virtual T SingleOperation(T A, T B, double Alpha) const override { return PCGExDataBlending::Max(A, B); }
+
+		virtual void BlendValuesRange(const T& A, const T& B, TArrayView<T>& Values, const TArrayView<double>& Alphas) const override { PCGExDataBlending::FillRange(Values, PCGExDataBlending::Max(A, B)); }
+		virtual void BlendValuesEach(TArrayView<T>& Values, const TConstArrayView<T>& Others, const TArrayView<double>& Alphas) const override { PCGExDataBlending::MaxRange(Values, Others); }
+		virtual void BlendValuesInto(T& Value, const TConstArrayView<T>& Others, const TArrayView<double>& Alphas) const override { PCGExDataBlending::MaxInto(Value, Others); }
 	};
 
 	template <typename T>
@@ -39,6 +58,10 @@ namespace PCGExDataBlending
 	{
 	public:
 		virtual T SingleOperation(T A, T B, double Alpha) const override { return PCGExDataBlending::Min(A, B); }
+
+		virtual void BlendValuesRange(const T& A, const T& B, TArrayView<T>& Values, const TArrayView<double>& Alphas) const override { PCGExDataBlending::FillRange(Values, PCGExDataBlending::Min(A, B)); }
+		virtual void BlendValuesEach(TArrayView<T>& Values, const TConstArrayView<T>& Others, const TArrayView<double>& Alphas) const override { PCGExDataBlending::MinRange(Values, Others); }
+		virtual void BlendValuesInto(T& Value, const TConstArrayView<T>& Others, const TArrayView<double>& Alphas) const override { PCGExDataBlending::MinInto(Value, Others); }
 	};
 
 	template <typename T>
@@ -46,6 +69,10 @@ namespace PCGExDataBlending
 	{
 	public:
 		virtual T SingleOperation(T A, T B, double Alpha) const override { return PCGExDataBlending::Lerp(A, B, Alpha); }
+
+		virtual void BlendValuesRange(const T& A, const T& B, TArrayView<T>& Values, const TArrayView<double>& Alphas) const override { PCGExDataBlending::LerpRange(Values, A, B, Alphas); }
+		virtual void BlendValuesEach(TArrayView<T>& Values, const TConstArrayView<T>& Others, const TArrayView<double>& Alphas) const override { PCGExDataBlending::LerpRange(Values, Others, Alphas); }
+		virtual void BlendValuesInto(T& Value, const TConstArrayView<T>& Others, const TArrayView<double>& Alphas) const override { PCGExDataBlending::LerpInto(Value, Others, Alphas); }
 	};
 
 	template <typename T>
@@ -53,5 +80,9 @@ namespace PCGExDataBlending
 	{
 	public:
 		virtual T SingleOperation(T A, T B, double Alpha) const override { return B; }
+
+		virtual void BlendValuesRange(const T& A, const T& B, TArrayView<T>& Values, const TArrayView<double>& Alphas) const override { PCGExDataBlending::FillRange(Values, B); }
+		virtual void BlendValuesEach(TArrayView<T>& Values, const TConstArrayView<T>& Others, const TArrayView<double>& Alphas) const override { PCGExDataBlending::CopyRange(Values, Others); }
+		virtual void BlendValuesInto(T& Value, const TConstArrayView<T>& Others, const TArrayView<double>& Alphas) const override { if (!Others.IsEmpty()) { Value = Others.Last(); } }
 	};
 }
@@ -73,6 +73,12 @@ PCGEX_BLEND_CASE(Max)
 
 		void FullBlendToOne(const TArrayView<double>& Alphas) const;
 
+		/**
+		 * Successively blend secondary points [StartIndex, StartIndex + Count[ into Target, as repeated Blend(Target, Point, Target, Alpha) would.
+		 * Each attribute (and the point properties) is reduced as a whole range, independently from the others.
+		 */
+		void BlendRangeInto(const PCGEx::FPointRef& Target, const int32 StartIndex, const int32 Count, const TArrayView<double>& Alphas, const bool bParallel = true) const;
+
 		void Write(bool bFlush = true);
 		void Flush();
 
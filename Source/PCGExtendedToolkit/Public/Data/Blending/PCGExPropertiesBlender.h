@@ -10,6 +10,10 @@
 
 namespace PCGExDataBlending
 {
+	typedef void (*FPropertyPrepareFunc)(FPCGPoint& Target);
+	typedef void (*FPropertyBlendFunc)(const FPCGPoint& A, const FPCGPoint& B, FPCGPoint& Target, double Alpha);
+	typedef void (*FPropertyCompleteFunc)(FPCGPoint& Target, double Alpha);
+
 	struct PCGEXTENDEDTOOLKIT_API FPropertiesBlender
 	{
 #define PCGEX_BLEND_FUNCREF(_TYPE, _NAME, ...) bool bAverage##_NAME = false; EPCGExDataBlendingType _NAME##Blending = EPCGExDataBlendingType::Weight;
@@ -31,7 +35,10 @@ namespace PCGExDataBlending
 			PCGEX_FOREACH_BLEND_POINTPROPERTY(PCGEX_BLEND_COPY)
 #undef PCGEX_BLEND_COPY
 			DefaultBlending(Other.DefaultBlending),
-			bRequiresPrepare(Other.bRequiresPrepare)
+			bRequiresPrepare(Other.bRequiresPrepare),
+			PreparePlan(Other.PreparePlan),
+			BlendPlan(Other.BlendPlan),
+			CompletePlan(Other.CompletePlan)
 		{
 		}
 
@@ -49,5 +56,13 @@ namespace PCGExDataBlending
 		void CompleteRangeBlending(const TArrayView<FPCGPoint>& Targets, const double Alpha) const;
 
 		void BlendRangeOnce(const FPCGPoint& A, const FPCGPoint& B, const TArrayView<FPCGPoint>& Targets, const TArrayView<double>& Alphas) const;
+
+	protected:
+		// Compiled by Init : one specialized step per active property, properties blended with None have no step at all.
+		TArray<FPropertyPrepareFunc, TInlineAllocator<9>> PreparePlan;
+		TArray<FPropertyBlendFunc, TInlineAllocator<9>> BlendPlan;
+		TArray<FPropertyCompleteFunc, TInlineAllocator<9>> CompletePlan;
+
+		void CompilePlan();
 	};
 }
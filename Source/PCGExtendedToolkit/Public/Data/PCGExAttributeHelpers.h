@@ -375,6 +375,34 @@ namespace PCGEx
 		}
 	};
 
+	/**
+	 * Read an input attribute column through the FPointIO attribute cache, so it is only decoded once
+	 * no matter how many readers & getters need it.
+	 * @tparam T Attribute type, must match the attribute underlying type
+	 * @param PointIO 
+	 * @param AttributeName 
+	 * @return nullptr if the attribute doesn't exist as T, or if the IO can't be cached
+	 */
+	template <typename T>
+	static TSharedPtr<const TArray<T>> ReadCachedColumn(PCGExData::FPointIO& PointIO, const FName AttributeName)
+	{
+		PCGExData::FAttributeCache* Cache = PointIO.GetAttributeCache();
+		if (!Cache) { return nullptr; }
+
+		return Cache->FindOrAdd<T>(
+			AttributeName, [&](TArray<T>& OutValues)
+			{
+				const UPCGPointData* InData = PointIO.GetIn();
+				FPCGMetadataAttributeBase* Attribute = InData->Metadata->GetMutableAttribute(AttributeName);
+				if (!Attribute || Attribute->GetTypeId() != static_cast<int16>(PCG::Private::MetadataTypes<T>::Id)) { return false; }
+
+				const FPCGAttributeAccessor<T> Accessor(static_cast<FPCGMetadataAttribute<T>*>(Attribute), InData->Metadata);
+				OutValues.SetNum(PointIO.GetNum());
+				TArrayView<T> View(OutValues);
+				return Accessor.GetRange(View, 0, *PointIO.CreateInKeys(), PCGEX_AAFLAG);
+			});
+	}
+
 	template <typename T>
 	class PCGEXTENDEDTOOLKIT_API FAttributeIOBase
 	{
@@ -395,7 +423,9 @@ namespace PCGEx
 		void SetNum(int32 Num) { Values.SetNumZeroed(Num); }
 		virtual bool Bind(PCGExData::FPointIO& PointIO) = 0;
 
-		T operator[](int32 Index) const { return this->Values[Index]; }
+		/** Values to read from; either owned Values, or a column shared with other readers. */
+		const TArray<T>& GetValues() const { return *ReadValues; }
+		T operator[](int32 Index) const { return (*ReadValues)[Index]; }
 
 		bool IsValid() { return Accessor != nullptr; }
 
@@ -404,6 +434,9 @@ namespace PCGEx
 			PCGEX_DELETE(Accessor)
 			Values.Empty();
 		}
+
+	protected:
+		const TArray<T>* ReadValues = &Values;
 	};
 
 	template <typename T>
@@ -481,10 +514,39 @@ namespace PCGEx
 			PCGEX_DELETE(this->Accessor)
 			this->Accessor = FConstAttributeAccessor<T>::Find(PointIO, this->Name);
 			if (!this->Accessor) { return false; }
+
+			// Hold on to the cached column rather than copying it, duplicate reads then only cost a reference
+			SharedValues = ReadCachedColumn<T>(PointIO, this->Name);
+			if (SharedValues)
+			{
+				this->Values.Empty();
+				this->ReadValues = SharedValues.Get();
+				return true;
+			}
+
+			this->ReadValues = &this->Values;
 			this->SetNum(PointIO.GetNum());
 			this->Accessor->GetRange(this->Values);
 			return true;
 		}
+
+		/** Move the values out of the reader, only copying them if they are shared. The reader is left empty. */
+		TArray<T> ConsumeValues()
+		{
+			TArray<T> OutValues = SharedValues ? *SharedValues : MoveTemp(this->Values);
+			SharedValues.Reset();
+			this->Values.Empty();
+			this->ReadValues = &this->Values;
+			return OutValues;
+		}
+
+		virtual ~TFAttributeReader() override
+		{
+			SharedValues.Reset();
+		}
+
+	protected:
+		TSharedPtr<const TArray<T>> SharedValues;
 	};
 
 #pragma endregion
@@ -542,20 +604,43 @@ namespace PCGEx
 					[&](auto DummyValue) -> void
 					{
 						using RawT = decltype(DummyValue);
-						TArray<RawT> RawValues;
 
-						RawValues.SetNumUninitialized(NumPoints);
 						Values.SetNumUninitialized(NumPoints);
 
+						if (const TSharedPtr<const TArray<RawT>> Column = ReadCachedColumn<RawT>(const_cast<PCGExData::FPointIO&>(PointIO), Selector.GetName()))
+						{
+							ConvertRange(TArrayView<const RawT>(*Column), 0);
+							return;
+						}
+
 						FPCGMetadataAttribute<RawT>* TypedAttribute = InData->Metadata->GetMutableTypedAttribute<RawT>(Selector.GetName());
 						FPCGAttributeAccessor<RawT>* Accessor = new FPCGAttributeAccessor<RawT>(TypedAttribute, InData->Metadata);
 						IPCGAttributeAccessorKeys* Keys = const_cast<PCGExData::FPointIO&>(PointIO).CreateInKeys();
-						TArrayView<RawT> View(RawValues);
-						Accessor->GetRange(View, 0, *Keys, PCGEX_AAFLAG);
 
-						for (int i = 0; i < NumPoints; i++) { Values[i] = Convert(RawValues[i]); }
+						if constexpr (std::is_same_v<RawT, T>)
+						{
+							// Read straight into Values, then convert in place
+							TArrayView<RawT> View(Values);
+							Accessor->GetRange(View, 0, *Keys, PCGEX_AAFLAG);
+							ConvertRange(TArrayView<const RawT>(Values), 0);
+						}
+						else
+						{
+							// Stream raw values through a chunk-sized buffer that stays in cache
+							TArray<RawT> RawValues;
+							RawValues.SetNum(FMath::Min(NumPoints, ConvertChunkSize));
+
+							for (int32 StartIndex = 0; StartIndex < NumPoints; StartIndex += ConvertChunkSize)
+							{
+								const int32 Count = FMath::Min(ConvertChunkSize, NumPoints - StartIndex);
+								TArrayView<RawT> View(RawValues.GetData(), Count);
+								Accessor->GetRange(View, StartIndex, *Keys, PCGEX_AAFLAG);
+								ConvertRange(TArrayView<const RawT>(RawValues.GetData(), Count), StartIndex);
+							}
+
+							RawValues.Empty();
+						}
 
-						RawValues.Empty();
 						delete Accessor;
 					});
 
@@ -566,11 +651,12 @@ namespace PCGEx
 				const TUniquePtr<const IPCGAttributeAccessor> Accessor = PCGAttributeAccessorHelpers::CreateConstAccessor(InData, Selector);
 				const TArray<FPCGPoint>& InPoints = InData->GetPoints();
 				Values.SetNumUninitialized(NumPoints);
-#define PCGEX_GET_BY_ACCESSOR(_ENUM, _ACCESSOR) case _ENUM: for (int i = 0; i < NumPoints; i++) { Values[i] = Convert(InPoints[i]._ACCESSOR); } break;
+#define PCGEX_GET_BY_ACCESSOR(_ENUM, _ACCESSOR) case _ENUM: ConvertPointProperties(InPoints, [](const FPCGPoint& Point) { return Point._ACCESSOR; }); break;
 				switch (Descriptor.Selector.GetPointProperty())
 				{
 				PCGEX_FOREACH_POINTPROPERTY(PCGEX_GET_BY_ACCESSOR)
 				}
+#undef PCGEX_GET_BY_ACCESSOR
 
 				bValid = true;
 			}
@@ -587,15 +673,59 @@ namespace PCGEx
 		T operator[](int32 Index) const { return bValid ? Values[Index] : GetDefaultValue(); }
 
 	protected:
+		static constexpr int32 ConvertChunkSize = 1024;
+
 		virtual T GetDefaultValue() const = 0;
 
 #define  PCGEX_PRINT_VIRTUAL(_TYPE, _NAME, ...) virtual T Convert(const _TYPE Value) const { return GetDefaultValue(); };
 		PCGEX_FOREACH_SUPPORTEDTYPES(PCGEX_PRINT_VIRTUAL)
+
+		/**
+		 * Convert a contiguous range of raw values into Values, starting at StartIndex.
+		 * The default implementation goes through the virtual Convert; getters deriving from TAttributeGetter
+		 * override it so there is a single virtual call per range.
+		 */
+#define  PCGEX_PRINT_VIRTUAL_RANGE(_TYPE, _NAME, ...) virtual void ConvertRange(const TArrayView<const _TYPE>& InValues, const int32 StartIndex) { T* Out = Values.GetData() + StartIndex; for (int i = 0; i < InValues.Num(); i++) { Out[i] = Convert(InValues[i]); } };
+		PCGEX_FOREACH_SUPPORTEDTYPES(PCGEX_PRINT_VIRTUAL_RANGE)
+#undef PCGEX_PRINT_VIRTUAL_RANGE
+
+		template <typename FGetFunc>
+		void ConvertPointProperties(const TArray<FPCGPoint>& InPoints, FGetFunc&& Get)
+		{
+			using RawT = decltype(Get(InPoints[0]));
+
+			const int32 NumPoints = InPoints.Num();
+			TArray<RawT> RawValues;
+			RawValues.SetNum(FMath::Min(NumPoints, ConvertChunkSize));
+
+			for (int32 StartIndex = 0; StartIndex < NumPoints; StartIndex += ConvertChunkSize)
+			{
+				const int32 Count = FMath::Min(ConvertChunkSize, NumPoints - StartIndex);
+				for (int i = 0; i < Count; i++) { RawValues[i] = Get(InPoints[StartIndex + i]); }
+				ConvertRange(TArrayView<const RawT>(RawValues.GetData(), Count), StartIndex);
+			}
+		}
+	};
+
+	/**
+	 * Getter base converting ranges through the concrete getter type rather than a per-value virtual call.
+	 * Convert still dispatches to the final overrider, so getters deriving from a getter stay correct;
+	 * the call is only resolved at compile time and inlined when FGetter is final.
+	 * FGetter must befriend TAttributeGetter so its protected Convert overloads are reachable.
+	 */
+	template <typename T, typename FGetter>
+	struct TAttributeGetter : public FAttributeGetter<T>
+	{
+	protected:
+#define PCGEX_PRINT_CONVERT_RANGE(_TYPE, _NAME, ...) virtual void ConvertRange(const TArrayView<const _TYPE>& InValues, const int32 StartIndex) override { const FGetter* Getter = static_cast<const FGetter*>(this); T* Out = this->Values.GetData() + StartIndex; for (int i = 0; i < InValues.Num(); i++) { Out[i] = Getter->Convert(InValues[i]); } }
+		PCGEX_FOREACH_SUPPORTEDTYPES(PCGEX_PRINT_CONVERT_RANGE)
+#undef PCGEX_PRINT_CONVERT_RANGE
 	};
 
 
 #define PCGEX_SINGLE(_NAME, _TYPE)\
-struct PCGEXTENDEDTOOLKIT_API FLocal ## _NAME ## Input : public FAttributeGetter<_TYPE>	{\
+struct PCGEXTENDEDTOOLKIT_API FLocal ## _NAME ## Input final : public TAttributeGetter<_TYPE, FLocal ## _NAME ## Input>	{\
+friend struct TAttributeGetter<_TYPE, FLocal ## _NAME ## Input>;\
 protected: \
 virtual _TYPE GetDefaultValue() const override{ return 0; }\
 virtual _TYPE Convert(const int32 Value) const override { return static_cast<_TYPE>(Value); } \
@@ -626,7 +756,8 @@ virtual _TYPE Convert(const FName Value) const override { return static_cast<_TY
 #undef PCGEX_SINGLE
 
 #define PCGEX_VECTOR_CAST(_NAME, _TYPE, VECTOR2D)\
-struct PCGEXTENDEDTOOLKIT_API FLocal ## _NAME ## Input : public FAttributeGetter<_TYPE>	{\
+struct PCGEXTENDEDTOOLKIT_API FLocal ## _NAME ## Input final : public TAttributeGetter<_TYPE, FLocal ## _NAME ## Input>	{\
+friend struct TAttributeGetter<_TYPE, FLocal ## _NAME ## Input>;\
 protected: \
 virtual _TYPE GetDefaultValue() const override { return _TYPE(0); }\
 virtual _TYPE Convert(const int32 Value) const override { return _TYPE(Value); } \
@@ -640,6 +771,8 @@ virtual _TYPE Convert(const FQuat Value) const override { return _TYPE(Value.Get
 virtual _TYPE Convert(const FTransform Value) const override { return _TYPE(Value.GetLocation()); }\
 virtual _TYPE Convert(const bool Value) const override { return _TYPE(Value); }\
 virtual _TYPE Convert(const FRotator Value) const override { return _TYPE(Value.Vector()); }\
+virtual _TYPE Convert(const FString Value) const override { return GetDefaultValue(); }\
+virtual _TYPE Convert(const FName Value) const override { return GetDefaultValue(); }\
 };
 
 	PCGEX_VECTOR_CAST(Vector2, FVector2D, { return Value;})
@@ -651,7 +784,8 @@ virtual _TYPE Convert(const FRotator Value) const override { return _TYPE(Value.
 #undef PCGEX_VECTOR_CAST
 
 #define PCGEX_LITERAL_CAST(_NAME, _TYPE)\
-struct PCGEXTENDEDTOOLKIT_API FLocal ## _NAME ## Input : public FAttributeGetter<_TYPE>	{\
+struct PCGEXTENDEDTOOLKIT_API FLocal ## _NAME ## Input final : public TAttributeGetter<_TYPE, FLocal ## _NAME ## Input>	{\
+friend struct TAttributeGetter<_TYPE, FLocal ## _NAME ## Input>;\
 protected: \
 virtual _TYPE GetDefaultValue() const override { return _TYPE(""); }\
 virtual _TYPE Convert(const int32 Value) const override { return _TYPE(FString::FromInt(Value)); } \
@@ -679,8 +813,10 @@ virtual _TYPE Convert(const FName Value) const override { return _TYPE(Value.ToS
 
 #pragma region Local Attribute Getter
 
-	struct PCGEXTENDEDTOOLKIT_API FLocalSingleFieldGetter : public FAttributeGetter<double>
+	struct PCGEXTENDEDTOOLKIT_API FLocalSingleFieldGetter : public TAttributeGetter<double, FLocalSingleFieldGetter>
 	{
+		friend struct TAttributeGetter<double, FLocalSingleFieldGetter>;
+
 		FLocalSingleFieldGetter()
 		{
 		}
@@ -767,8 +903,10 @@ virtual _TYPE Convert(const FName Value) const override { return _TYPE(Value.ToS
 		virtual double Convert(const FName Value) const override { return PCGExMath::ConvertStringToDouble(Value.ToString()); }
 	};
 
-	struct PCGEXTENDEDTOOLKIT_API FLocalDirectionGetter : public FAttributeGetter<FVector>
+	struct PCGEXTENDEDTOOLKIT_API FLocalDirectionGetter : public TAttributeGetter<FVector, FLocalDirectionGetter>
 	{
+		friend struct TAttributeGetter<FVector, FLocalDirectionGetter>;
+
 		FLocalDirectionGetter()
 		{
 		}
@@ -811,8 +949,10 @@ virtual _TYPE Convert(const FName Value) const override { return _TYPE(Value.ToS
 		virtual FVector Convert(const FName Value) const override { return GetDefaultValue(); }
 	};
 
-	struct PCGEXTENDEDTOOLKIT_API FLocalToStringGetter : public FAttributeGetter<FString>
+	struct PCGEXTENDEDTOOLKIT_API FLocalToStringGetter : public TAttributeGetter<FString, FLocalToStringGetter>
 	{
+		friend struct TAttributeGetter<FString, FLocalToStringGetter>;
+
 		FLocalToStringGetter()
 		{
 		}
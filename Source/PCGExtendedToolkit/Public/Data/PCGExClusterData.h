@@ -0,0 +1,34 @@
+﻿// Copyright Timothé Lapetite 2023
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Data/PCGPointData.h"
+
+#include "Graph/PCGExMesh.h"
+
+#include "PCGExClusterData.generated.h"
+
+/**
+ * Edges point data carrying the cluster topology it was built with.
+ * Topology is only kept while the data is forwarded as-is; duplicates are regular point data
+ * and edges nodes will fall back to decoding EdgeStart/EdgeEnd attributes.
+ */
+UCLASS(BlueprintType, ClassGroup = (Procedural), Category="PCGEx|Data")
+class PCGEXTENDEDTOOLKIT_API UPCGExClusterEdgesData : public UPCGPointData
+{
+	GENERATED_BODY()
+
+public:
+	UPCGExClusterEdgesData(const FObjectInitializer& ObjectInitializer);
+
+	void SetTopology(const TSharedPtr<const PCGExMesh::FClusterTopology>& InTopology);
+	TSharedPtr<const PCGExMesh::FClusterTopology> GetTopology() const;
+
+	virtual void BeginDestroy() override;
+
+protected:
+	mutable FRWLock TopologyLock;
+	TSharedPtr<const PCGExMesh::FClusterTopology> Topology;
+};
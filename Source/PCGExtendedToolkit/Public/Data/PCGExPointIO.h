@@ -9,6 +9,7 @@
 #include "Data/PCGPointData.h"
 
 #include "PCGEx.h"
+#include "Metadata/PCGMetadataAttributeTraits.h"
 #include "Metadata/Accessors/PCGAttributeAccessorKeys.h"
 
 namespace PCGExData
@@ -18,7 +19,122 @@ namespace PCGExData
 		NoOutput UMETA(DisplayName = "No Output"),
 		NewOutput UMETA(DisplayName = "Create Empty Output Object"),
 		DuplicateInput UMETA(DisplayName = "Duplicate Input Object"),
-		Forward UMETA(DisplayName = "Forward Input Object")
+		Forward UMETA(DisplayName = "Forward Input Object"),
+		CopyOnWrite UMETA(DisplayName = "Copy-on-write Input Object")
+	};
+
+	/**
+	 * Decoded input attribute columns, keyed by attribute name & type.
+	 * Columns are ref-counted : the cache releases its reference on Flush, and holders keep theirs alive until they're done.
+	 */
+	class PCGEXTENDEDTOOLKIT_API FAttributeCache
+	{
+		struct FColumnBase
+		{
+			virtual ~FColumnBase() = default;
+		};
+
+		template <typename T>
+		struct TColumn final : FColumnBase
+		{
+			TArray<T> Values;
+		};
+
+		mutable FRWLock CacheLock;
+		TMap<TPair<FName, int16>, TSharedPtr<FColumnBase>> Columns;
+
+	public:
+		~FAttributeCache() { Flush(); }
+
+		/**
+		 * Thread-safe. Return the cached column, or fill & cache a new one.
+		 * @tparam T Column type
+		 * @param Name Attribute name
+		 * @param Fill Called at most once per column, returns false if the column could not be read
+		 * @return nullptr if Fill failed
+		 */
+		template <typename T, typename FillFunc>
+		TSharedPtr<const TArray<T>> FindOrAdd(const FName Name, FillFunc&& Fill)
+		{
+			const TPair<FName, int16> Key(Name, static_cast<int16>(PCG::Private::MetadataTypes<T>::Id));
+
+			{
+				FReadScopeLock ReadLock(CacheLock);
+				if (const TSharedPtr<FColumnBase>* Column = Columns.Find(Key)) { return Get<T>(*Column); }
+			}
+
+			FWriteScopeLock WriteLock(CacheLock);
+			if (const TSharedPtr<FColumnBase>* Column = Columns.Find(Key)) { return Get<T>(*Column); }
+
+			const TSharedPtr<TColumn<T>> NewColumn = MakeShared<TColumn<T>>();
+			if (!Fill(NewColumn->Values)) { return nullptr; }
+
+			Columns.Add(Key, NewColumn);
+			return TSharedPtr<const TArray<T>>(NewColumn, &NewColumn->Values);
+		}
+
+		void Flush()
+		{
+			FWriteScopeLock WriteLock(CacheLock);
+			Columns.Empty();
+		}
+
+	protected:
+		template <typename T>
+		static TSharedPtr<const TArray<T>> Get(const TSharedPtr<FColumnBase>& Column)
+		{
+			return TSharedPtr<const TArray<T>>(Column, &StaticCastSharedPtr<TColumn<T>>(Column)->Values);
+		}
+	};
+
+	enum class EPointsCache : uint8
+	{
+		None      = 0,
+		Positions = 1 << 0,
+		Rotations = 1 << 1,
+		Scales    = 1 << 2,
+		Extents   = 1 << 3,
+	};
+
+	ENUM_CLASS_FLAGS(EPointsCache)
+
+	/**
+	 * Structure-of-arrays copy of point components, for hot loops that only need a few of them out of each FPCGPoint.
+	 * Components are built on demand, in parallel, and stay valid until the cache is invalidated.
+	 * Views must not be held across an invalidation.
+	 */
+	class PCGEXTENDEDTOOLKIT_API FPointsCache
+	{
+		mutable FRWLock CacheLock;
+		EPointsCache Built = EPointsCache::None;
+
+		TArray<double> X;
+		TArray<double> Y;
+		TArray<double> Z;
+		TArray<FQuat> Rotations;
+		TArray<FVector> Scales;
+		TArray<FVector> Extents;
+
+	public:
+		~FPointsCache() { Invalidate(); }
+
+		/**
+		 * Thread-safe. Build the requested components that are not cached yet.
+		 * @param Points Points to read from
+		 * @param Components 
+		 * @param bParallel 
+		 */
+		void Require(const TArray<FPCGPoint>& Points, const EPointsCache Components, const bool bParallel = true);
+		void Invalidate();
+
+		TConstArrayView<double> GetX() const { return X; }
+		TConstArrayView<double> GetY() const { return Y; }
+		TConstArrayView<double> GetZ() const { return Z; }
+		TConstArrayView<FQuat> GetRotations() const { return Rotations; }
+		TConstArrayView<FVector> GetScales() const { return Scales; }
+		TConstArrayView<FVector> GetExtents() const { return Extents; }
+
+		FVector GetPosition(const int32 Index) const { return FVector(X[Index], Y[Index], Z[Index]); }
 	};
 
 	/**
@@ -40,6 +156,9 @@ namespace PCGExData
 
 		FPointIO* RootIO = nullptr;
 
+		FAttributeCache AttributeCache;
+		mutable FPointsCache PointsCache;
+
 	public:
 		FPCGTaggedData Source; // Source struct
 		FPCGTaggedData Output; // Source struct
@@ -67,8 +186,34 @@ namespace PCGExData
 			InitializeOutput(InInit);
 		}
 
+		/**
+		 * Create the output data.
+		 * CopyOnWrite copies input points but not their attributes : output metadata is a child of the input one,
+		 * so existing values are read from the input and only the attributes that get written are materialized on the output.
+		 * Prefer it over DuplicateInput for nodes that only touch a few attributes or point properties.
+		 * @param InitOut 
+		 */
 		void InitializeOutput(EInit InitOut = EInit::NoOutput);
 
+		/**
+		 * Same as InitializeOutput, but creates new outputs as a specific UPCGPointData subclass
+		 * @tparam T UPCGPointData type
+		 * @param InitOut 
+		 */
+		template <typename T>
+		void InitializeOutput(const EInit InitOut = EInit::NoOutput)
+		{
+			if (InitOut != EInit::NewOutput)
+			{
+				InitializeOutput(InitOut);
+				return;
+			}
+
+			T* TypedOut = NewObject<T>();
+			if (In) { TypedOut->InitializeFromData(In); }
+			Out = TypedOut;
+		}
+
 		~FPointIO();
 
 		const UPCGPointData* GetIn() const;
@@ -80,6 +225,21 @@ namespace PCGExData
 		FPCGAttributeAccessorKeysPoints* CreateOutKeys();
 		FPCGAttributeAccessorKeysPoints* GetOutKeys() const;
 
+		/**
+		 * Input attribute cache, shared with the root IO if any.
+		 * Only valid when the output is not the input itself, as writes would make cached columns stale.
+		 */
+		FAttributeCache* GetAttributeCache();
+
+		/**
+		 * Input points SoA cache, shared with the root IO if any. Requested components are built on first access.
+		 * Adding points to a forwarded output invalidates it; writes through GetMutablePoint on a forwarded output
+		 * must be followed by InvalidatePointsCache.
+		 * @param Components Components that must be valid in the returned cache
+		 */
+		const FPointsCache& GetInPointsCache(const EPointsCache Components = EPointsCache::Positions);
+		void InvalidatePointsCache() const;
+
 		FName DefaultOutputLabel = PCGEx::OutputPointsLabel;
 
 		const FPCGPoint& GetInPoint(const int32 Index) const { return In->GetPoints()[Index]; }
@@ -100,6 +260,24 @@ namespace PCGExData
 		void AddPoint(FPCGPoint& Point, int32& OutIndex, bool bInit) const;
 		void AddPoint(FPCGPoint& Point, int32& OutIndex, const FPCGPoint& FromPoint) const;
 
+		/**
+		 * Append a block of default points to the output at once, and return the index of the first one.
+		 * Must not be called while other threads write to output points; however once the block is added,
+		 * each thread can write its own slice of it without locking. Metadata entries are then created in bulk with InitPoints.
+		 * @param Count Number of points to add
+		 * @return Index of the first added point
+		 */
+		int32 AddPoints(const int32 Count) const;
+
+		/**
+		 * Create metadata entries for a range of output points, in parallel.
+		 * Points that are copies of input points inherit from their input entry, others get a new one.
+		 * @param StartIndex 
+		 * @param Count 
+		 * @param bParallel 
+		 */
+		void InitPoints(const int32 StartIndex, const int32 Count, const bool bParallel = true) const;
+
 		UPCGPointData* NewEmptyOutput() const;
 		UPCGPointData* NewEmptyOutput(FPCGContext* Context, FName PinLabel = NAME_None) const;
 
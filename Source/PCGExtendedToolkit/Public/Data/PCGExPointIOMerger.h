@@ -18,6 +18,9 @@ public:
 	void DoMerge();
 
 protected:
+	template <typename T>
+	void CopyAttributeRange(PCGEx::TFAttributeWriter<T>* Writer, const FName AttributeName, const int32 SourceIndex, const int32 StartIndex) const;
+
 	int32 TotalPoints = 0;
 	TMap<FName, PCGEx::FAttributeIdentity> Identities;
 	TMap<FName, bool> AllowsInterpolation;
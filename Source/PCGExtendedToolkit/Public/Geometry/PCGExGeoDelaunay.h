@@ -0,0 +1,152 @@
+﻿// Copyright Timothé Lapetite 2023
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Graph/PCGExEdge.h"
+
+namespace PCGExGeo
+{
+	/**
+	 * 2D Delaunay triangulation, Guibas & Stolfi divide-and-conquer over a quad-edge structure.
+	 * O(n log n) worst case. Exact duplicates are ignored and end up with no edges.
+	 */
+	class PCGEXTENDEDTOOLKIT_API FDelaunay2
+	{
+	public:
+		/** Unique undirected edges, indices refer to input positions. */
+		TArray<PCGExGraph::FUnsignedEdge> Edges;
+		/** Counter-clockwise triangles, indices refer to input positions. */
+		TArray<FIntVector> Triangles;
+
+		FDelaunay2()
+		{
+		}
+
+		~FDelaunay2();
+
+		/**
+		 * Triangulate the given positions.
+		 * @param Positions
+		 * @return false if there was not enough distinct positions to create a single edge
+		 */
+		bool Process(const TArray<FVector2D>& Positions);
+
+	protected:
+		TArray<FVector2D> Sites;
+		TArray<int32> SiteIndices;
+
+		TArray<int32> QuadNext;
+		TArray<int32> QuadOrg;
+		TArray<bool> QuadDeleted;
+
+		static int32 Rot(const int32 E) { return (E & ~3) | ((E + 1) & 3); }
+		static int32 Sym(const int32 E) { return (E & ~3) | ((E + 2) & 3); }
+		static int32 InvRot(const int32 E) { return (E & ~3) | ((E + 3) & 3); }
+
+		int32 Onext(const int32 E) const { return QuadNext[E]; }
+		int32 Oprev(const int32 E) const { return Rot(QuadNext[Rot(E)]); }
+		int32 Lnext(const int32 E) const { return Rot(QuadNext[InvRot(E)]); }
+		int32 Rprev(const int32 E) const { return QuadNext[Sym(E)]; }
+		int32 Org(const int32 E) const { return QuadOrg[E]; }
+		int32 Dest(const int32 E) const { return QuadOrg[Sym(E)]; }
+
+		int32 MakeEdge(const int32 InOrg, const int32 InDest);
+		void Splice(const int32 A, const int32 B);
+		int32 Connect(const int32 A, const int32 B);
+		void DeleteEdge(const int32 E);
+
+		bool CCW(const int32 A, const int32 B, const int32 C) const;
+		bool RightOf(const int32 X, const int32 E) const { return CCW(X, Dest(E), Org(E)); }
+		bool LeftOf(const int32 X, const int32 E) const { return CCW(X, Org(E), Dest(E)); }
+		bool InCircle(const int32 A, const int32 B, const int32 C, const int32 D) const;
+
+		void Divide(const int32 Lo, const int32 Hi, int32& OutLeft, int32& OutRight);
+		void Gather();
+	};
+
+	/**
+	 * 3D Delaunay tetrahedralization, incremental Bowyer-Watson.
+	 * Sites are inserted along a Morton curve so point location walks stay short,
+	 * giving O(n log n) behavior on typical inputs.
+	 * Cavities are grown until star-shaped from the inserted site, which keeps the mesh valid on
+	 * cospherical inputs (grids) at the cost of strict Delaunay-ness on those degenerate spots.
+	 */
+	class PCGEXTENDEDTOOLKIT_API FDelaunay3
+	{
+	public:
+		/** Unique undirected edges, indices refer to input positions. */
+		TArray<PCGExGraph::FUnsignedEdge> Edges;
+		/** Positively oriented tetrahedra, indices refer to input positions. */
+		TArray<FIntVector4> Tetrahedra;
+		/** Sites that could not be inserted during the last Process, they are left without edges. */
+		int32 NumSkippedSites = 0;
+
+		FDelaunay3()
+		{
+		}
+
+		~FDelaunay3();
+
+		/**
+		 * Tetrahedralize the given positions.
+		 * @param Positions
+		 * @return false if the positions could not produce a single tetrahedron, or are (almost) flat along an axis
+		 */
+		bool Process(const TArray<FVector>& Positions);
+
+	protected:
+		TArray<FVector> Sites;
+
+		TArray<FIntVector4> Cells;
+		TArray<FIntVector4> CellNeighbors;
+		TArray<bool> CellDead;
+
+		TArray<int32> FreeCells;
+
+		TArray<int32> Cavity;
+		TArray<int32> CavityStamp;
+		TArray<FIntVector> BoundaryFaces;
+		TArray<int32> BoundaryLinks;
+		TMap<uint64, int32> OpenFaces;
+		int32 Stamp = 0;
+		int32 LastCell = 0;
+
+		static double Orient(const FVector& A, const FVector& B, const FVector& C, const FVector& D);
+
+		int32 AddCell(const int32 A, const int32 B, const int32 C, const int32 D);
+		int32 Locate(const int32 Site) const;
+		bool Insert(const int32 Site);
+		bool InSphere(const int32 Cell, const FVector& P) const;
+	};
+
+	/**
+	 * Keep only edges whose diametral sphere is empty of any other position.
+	 * Edges are expected to be Delaunay edges of the same positions; each edge is then only tested against
+	 * the Delaunay neighbors of its start, which is sufficient for an exact result.
+	 * @param Positions
+	 * @param Edges
+	 * @param bParallel
+	 */
+	PCGEXTENDEDTOOLKIT_API void PruneGabriel(const TArray<FVector>& Positions, TArray<PCGExGraph::FUnsignedEdge>& Edges, const bool bParallel = true);
+
+	/**
+	 * Keep only edges with no other position closer to both ends than they are to each other.
+	 * Edges are expected to be Delaunay edges of the same positions; candidates are found by walking the
+	 * Delaunay graph inside the disk enclosing the edge lune, which is connected.
+	 * @param Positions
+	 * @param Edges
+	 * @param bParallel
+	 */
+	PCGEXTENDEDTOOLKIT_API void PruneRelativeNeighborhood(const TArray<FVector>& Positions, TArray<PCGExGraph::FUnsignedEdge>& Edges, const bool bParallel = true);
+
+	/**
+	 * Remove the longest edge of each triangle.
+	 * @param Positions
+	 * @param Triangles Delaunay triangles, or tetrahedra faces
+	 * @param Edges
+	 */
+	PCGEXTENDEDTOOLKIT_API void PruneUrquhart(const TArray<FVector>& Positions, const TArray<FIntVector>& Triangles, TArray<PCGExGraph::FUnsignedEdge>& Edges);
+}
@@ -0,0 +1,63 @@
+﻿// Copyright Timothé Lapetite 2023
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace PCGExGeo
+{
+	/**
+	 * Static, balanced 3D KD-tree over a set of positions.
+	 * Positions are copied in tree order so leaves are contiguous in memory.
+	 * Queries are const and can safely run concurrently once built.
+	 */
+	class PCGEXTENDEDTOOLKIT_API FKDTree
+	{
+	public:
+		static constexpr int32 LeafSize = 8;
+
+		FKDTree()
+		{
+		}
+
+		~FKDTree();
+
+		/**
+		 * Build the tree. O(n log n).
+		 * @param InPositions 
+		 */
+		void Build(const TArray<FVector>& InPositions);
+
+		int32 Num() const { return Indices.Num(); }
+
+		/**
+		 * Find up to K nearest positions within a given radius, closest first.
+		 * @param Center 
+		 * @param K Maximum number of neighbors
+		 * @param MaxDistanceSquared Squared search radius
+		 * @param OutNeighbors Input position indices
+		 * @param Ignore Input position index to skip, usually the queried position itself
+		 */
+		void FindNearest(const FVector& Center, const int32 K, const double MaxDistanceSquared, TArray<int32>& OutNeighbors, const int32 Ignore = -1) const;
+
+	protected:
+		struct FNode
+		{
+			double Split = 0;
+			int32 Begin = 0;
+			int32 End = 0;
+			int32 Left = -1;
+			int32 Right = -1;
+			int32 Axis = -1;
+
+			bool IsLeaf() const { return Left == -1; }
+		};
+
+		TArray<FNode> Nodes;
+		TArray<FVector> Points;
+		TArray<int32> Indices;
+
+		int32 BuildNode(const int32 Begin, const int32 End);
+	};
+}
@@ -54,6 +54,7 @@ struct PCGEXTENDEDTOOLKIT_API FPCGExBridgeEdgeIslandsContext : public FPCGExEdge
 	EPCGExBridgeIslandMethod BridgeMethod;
 
 	PCGExData::FPointIO* ConsolidatedEdges = nullptr;
+	int32 FirstBridgeIndex = -1;
 	TSet<PCGExMesh::FMesh*> VisitedMeshes;
 };
 
@@ -75,13 +76,15 @@ class PCGEXTENDEDTOOLKIT_API FBridgeMeshesTask : public FPCGExNonAbandonableTask
 {
 public:
 	FBridgeMeshesTask(
-		FPCGExAsyncManager* InManager, const int32 InTaskIndex, PCGExData::FPointIO* InPointIO, const int32 InOtherMeshIndex) :
+		FPCGExAsyncManager* InManager, const int32 InTaskIndex, PCGExData::FPointIO* InPointIO, const int32 InOtherMeshIndex, const int32 InBridgeIndex) :
 		FPCGExNonAbandonableTask(InManager, InTaskIndex, InPointIO),
-		OtherMeshIndex(InOtherMeshIndex)
+		OtherMeshIndex(InOtherMeshIndex),
+		BridgeIndex(InBridgeIndex)
 	{
 	}
 
 	int32 OtherMeshIndex = -1;
+	int32 BridgeIndex = -1;
 
 	virtual bool ExecuteTask() override;
 };
@@ -54,12 +54,18 @@ struct PCGEXTENDEDTOOLKIT_API FPCGExPromoteEdgesContext : public FPCGExGraphProc
 public:
 	EPCGExEdgeType EdgeType;
 	int32 MaxPossibleEdgesPerPoint = 0;
-	TSet<uint64> UniqueEdges;
+	PCGExGraph::FEdgeSet UniqueEdges;
 	TArray<PCGExGraph::FUnsignedEdge> Edges;
 
-	mutable FRWLock EdgeLock;
-
 	UPCGExEdgePromotingOperation* Promotion;
+
+	TArray<UPCGPointData*> PooledData;
+	TArray<FPCGMetadataAttribute<int32>*> PooledIdAttributes;
+	TArray<int32> EdgePools;          // Pool index of each edge
+	TArray<int32> EdgePoolStartIndex; // Index of the first point of each edge within its pool
+
+	void PreparePools();
+	void OutputPools();
 };
 
 class PCGEXTENDEDTOOLKIT_API FPCGExPromoteEdgesElement : public FPCGExGraphProcessorElement
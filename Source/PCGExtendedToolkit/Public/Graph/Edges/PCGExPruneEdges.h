@@ -5,6 +5,7 @@
 
 #include "CoreMinimal.h"
 #include "Graph/PCGExEdgesProcessor.h"
+#include "Pruning/PCGExEdgePruningOperation.h"
 #include "PCGExPruneEdges.generated.h"
 
 UCLASS(BlueprintType, ClassGroup = (Procedural), Category="PCGEx|Edges")
@@ -17,7 +18,7 @@ public:
 
 	//~Begin UPCGSettings interface
 #if WITH_EDITOR
-	PCGEX_NODE_INFOS(PruneEdges, "Edges : Prune", "Remove edges according using a custom processor.");
+	PCGEX_NODE_INFOS(PruneEdges, "Edges : Prune", "Remove edges according to a pruning operation.");
 #endif
 
 	virtual PCGExData::EInit GetEdgeOutputInitMode() const override;
@@ -26,6 +27,11 @@ protected:
 	virtual FPCGElementPtr CreateElement() const override;
 	//~End UPCGSettings interface
 
+public:
+	/** Pruning operation */
+	UPROPERTY(BlueprintReadOnly, EditAnywhere, Category = Settings, Instanced, meta=(PCG_Overridable, NoResetToDefault, ShowOnlyInnerProperties))
+	TObjectPtr<UPCGExEdgePruningOperation> Pruning;
+
 private:
 	friend class FPCGExPruneEdgesElement;
 };
@@ -33,6 +39,13 @@ private:
 struct PCGEXTENDEDTOOLKIT_API FPCGExPruneEdgesContext : public FPCGExEdgesProcessorContext
 {
 	friend class FPCGExPruneEdgesElement;
+
+	virtual ~FPCGExPruneEdgesContext() override;
+
+	UPCGExEdgePruningOperation* Pruning = nullptr;
+	TArray<bool> Pruned;
+
+	void WriteSurvivingEdges();
 };
 
 class PCGEXTENDEDTOOLKIT_API FPCGExPruneEdgesElement : public FPCGExEdgesProcessorElement
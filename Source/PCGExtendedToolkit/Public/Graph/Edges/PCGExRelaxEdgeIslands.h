@@ -8,6 +8,13 @@
 #include "Relaxing/PCGExForceDirectedRelaxing.h"
 #include "PCGExRelaxEdgeIslands.generated.h"
 
+UENUM(BlueprintType)
+enum class EPCGExRelaxConvergenceMetric : uint8
+{
+	Max UMETA(DisplayName = "Max", ToolTip="Largest vertex displacement of the last iteration."),
+	Mean UMETA(DisplayName = "Mean", ToolTip="Average vertex displacement of the last iteration."),
+};
+
 UCLASS(BlueprintType, ClassGroup = (Procedural), Category="PCGEx|Edges")
 class PCGEXTENDEDTOOLKIT_API UPCGExRelaxEdgeIslandsSettings : public UPCGExEdgesProcessorSettings
 {
@@ -32,6 +39,10 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable, ClampMin=1))
 	int32 Iterations = 100;
 
+	/** Number of iterations processed back-to-back within a single async dispatch. Lower values spread the work over more ticks. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Performance", meta = (PCG_Overridable, ClampMin=1))
+	int32 IterationsPerDispatch = 100;
+
 	/** Draw size. What it means depends on the selected debug type. */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, ClampMin=0, ClampMax=1))
 	double Influence = 1.0;
@@ -44,6 +55,34 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable, EditCondition="bUseLocalInfluence"))
 	FPCGExInputDescriptorWithSingleField LocalInfluence;
 
+	/** Stop relaxing a cluster as soon as its vertices displacement falls under a threshold. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable, InlineEditConditionToggle))
+	bool bUseConvergenceThreshold = false;
+
+	/** Displacement under which a cluster is considered settled. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable, EditCondition="bUseConvergenceThreshold", ClampMin=0))
+	double ConvergenceThreshold = 0.01;
+
+	/** How per-vertex displacement is reduced to a single residual value. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable))
+	EPCGExRelaxConvergenceMetric ConvergenceMetric = EPCGExRelaxConvergenceMetric::Max;
+
+	/** Write the final residual of the cluster to its vertices. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable, InlineEditConditionToggle))
+	bool bWriteResidual = false;
+
+	/** Name of the attribute to write the final residual to. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable, EditCondition="bWriteResidual"))
+	FName ResidualAttributeName = "Residual";
+
+	/** Write the number of iterations the cluster went through to its vertices. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable, InlineEditConditionToggle))
+	bool bWriteIterationCount = false;
+
+	/** Name of the attribute to write the iteration count to. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable, EditCondition="bWriteIterationCount"))
+	FName IterationCountAttributeName = "RelaxIterations";
+
 	UPROPERTY(BlueprintReadOnly, EditAnywhere, Category = Settings, Instanced, meta=(PCG_Overridable, NoResetToDefault, ShowOnlyInnerProperties))
 	TObjectPtr<UPCGExEdgeRelaxingOperation> Relaxing;
 
@@ -58,8 +97,23 @@ struct PCGEXTENDEDTOOLKIT_API FPCGExRelaxEdgeIslandsContext : public FPCGExEdges
 	virtual ~FPCGExRelaxEdgeIslandsContext() override;
 
 	int32 Iterations = 10;
+	int32 IterationsPerDispatch = 100;
 	int32 CurrentIteration = 0;
 	bool bUseLocalInfluence = false;
+
+	bool bUseConvergenceThreshold = false;
+	double ConvergenceThreshold = 0.01;
+	EPCGExRelaxConvergenceMetric ConvergenceMetric = EPCGExRelaxConvergenceMetric::Max;
+	bool bConverged = false;
+	double Residual = 0;
+
+	bool bWriteResidual = false;
+	FName ResidualAttributeName;
+	bool bWriteIterationCount = false;
+	FName IterationCountAttributeName;
+
+	PCGEx::TFAttributeWriter<double>* ResidualWriter = nullptr;
+	PCGEx::TFAttributeWriter<int32>* IterationCountWriter = nullptr;
 	PCGEx::FLocalSingleFieldGetter InfluenceGetter;
 
 	TArray<FVector> PrimaryBuffer;
@@ -80,3 +134,18 @@ protected:
 	virtual bool Boot(FPCGContext* InContext) const override;
 	virtual bool ExecuteInternal(FPCGContext* InContext) const override;
 };
+
+class PCGEXTENDEDTOOLKIT_API FPCGExRelaxMeshTask : public FPCGExNonAbandonableTask
+{
+public:
+	FPCGExRelaxMeshTask(FPCGExAsyncManager* InManager, const int32 InTaskIndex, PCGExData::FPointIO* InPointIO,
+	                    const int32 InNumIterations)
+		: FPCGExNonAbandonableTask(InManager, InTaskIndex, InPointIO),
+		  NumIterations(InNumIterations)
+	{
+	}
+
+	int32 NumIterations = 1;
+
+	virtual bool ExecuteTask() override;
+};
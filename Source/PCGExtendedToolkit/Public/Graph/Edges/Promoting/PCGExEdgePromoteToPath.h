@@ -7,6 +7,14 @@
 #include "PCGExEdgePromotingOperation.h"
 #include "PCGExEdgePromoteToPath.generated.h"
 
+UENUM(BlueprintType)
+enum class EPCGExEdgePathOutputMode : uint8
+{
+	PerEdge UMETA(DisplayName = "Per Edge", ToolTip="Each edge is output as its own two-points path data."),
+	Single UMETA(DisplayName = "Single", ToolTip="All edges are written into a single point data. Each path is identified by the Path ID attribute."),
+	PerIsland UMETA(DisplayName = "Per Island", ToolTip="One point data per island of connected edges. Each path is identified by the Path ID attribute."),
+};
+
 /**
  * 
  */
@@ -16,6 +24,20 @@ class PCGEXTENDEDTOOLKIT_API UPCGExEdgePromoteToPath : public UPCGExEdgePromotin
 	GENERATED_BODY()
 
 public:
+	/** How paths are grouped into output data. Pooled modes avoid creating one data object per edge. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings)
+	EPCGExEdgePathOutputMode OutputMode = EPCGExEdgePathOutputMode::PerEdge;
+
+	/** Attribute identifying which path a point belongs to, when paths are pooled. Both points of a path share the same ID. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(EditCondition="OutputMode!=EPCGExEdgePathOutputMode::PerEdge", EditConditionHides))
+	FName PathIdAttributeName = "PCGEx/PathId";
+
 	virtual bool GeneratesNewPointData() override;
 	virtual bool PromoteEdgeGen(UPCGPointData* InData, const PCGExGraph::FUnsignedEdge& Edge, const FPCGPoint& StartPoint, const FPCGPoint& EndPoint) override;
+
+	virtual bool GeneratesPooledPointData() override;
+	virtual bool PoolPerIsland() override;
+	virtual FName GetPooledIdAttributeName() override;
+	virtual int32 GetNumPointsPerEdge() override;
+	virtual bool PromoteEdgePooled(UPCGPointData* InData, const int32 StartIndex, const PCGExGraph::FUnsignedEdge& Edge, const FPCGPoint& StartPoint, const FPCGPoint& EndPoint) override;
 };
@@ -20,4 +20,18 @@ public:
 	virtual bool GeneratesNewPointData();
 	virtual void PromoteEdge(const PCGExGraph::FUnsignedEdge& Edge, const FPCGPoint& StartPoint, const FPCGPoint& EndPoint);
 	virtual bool PromoteEdgeGen(UPCGPointData* InData, const PCGExGraph::FUnsignedEdge& Edge, const FPCGPoint& StartPoint, const FPCGPoint& EndPoint);
+
+	/** Whether generated points are pooled into a few shared point data instead of one data per edge. */
+	virtual bool GeneratesPooledPointData();
+	/** Whether pooled point data are split per island of connected edges. */
+	virtual bool PoolPerIsland();
+	/** Name of the attribute used to identify each edge inside a pooled point data. NAME_None to skip. */
+	virtual FName GetPooledIdAttributeName();
+	virtual int32 GetNumPointsPerEdge();
+
+	/**
+	 * Write a single edge into an already sized pooled point data, starting at StartIndex.
+	 * Called in parallel, each edge owns its own range of GetNumPointsPerEdge() points.
+	 */
+	virtual bool PromoteEdgePooled(UPCGPointData* InData, const int32 StartIndex, const PCGExGraph::FUnsignedEdge& Edge, const FPCGPoint& StartPoint, const FPCGPoint& EndPoint);
 };
@@ -0,0 +1,29 @@
+﻿// Copyright Timothé Lapetite 2023
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PCGExEdgePruningOperation.h"
+#include "PCGExEdgePruneByAngle.generated.h"
+
+/**
+ * 
+ */
+UCLASS(BlueprintType, DisplayName = "Prune By Angle")
+class PCGEXTENDEDTOOLKIT_API UPCGExEdgePruneByAngle : public UPCGExEdgePruningOperation
+{
+	GENERATED_BODY()
+
+public:
+	virtual void PrepareForMesh(const PCGExData::FPointIO& PointIO, PCGExMesh::FMesh* Mesh, TArray<bool>* InPruned) override;
+	virtual void ProcessEdge(const int32 EdgeIndex) override;
+
+	/** When two edges sharing a vertex form an angle smaller than this (in degrees), the longest one is removed. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, ClampMin=0, ClampMax=180))
+	double MinAngle = 15;
+
+protected:
+	double MaxDot = 1;
+	bool IsShadowed(const int32 EdgeIndex, const int32 VertexIndex) const;
+};
@@ -0,0 +1,27 @@
+﻿// Copyright Timothé Lapetite 2023
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PCGExEdgePruningOperation.h"
+#include "PCGExEdgePruneByDegree.generated.h"
+
+/**
+ * 
+ */
+UCLASS(BlueprintType, DisplayName = "Prune By Degree")
+class PCGEXTENDEDTOOLKIT_API UPCGExEdgePruneByDegree : public UPCGExEdgePruningOperation
+{
+	GENERATED_BODY()
+
+public:
+	virtual void ProcessEdge(const int32 EdgeIndex) override;
+
+	/** Maximum number of edges per vertex. Only the shortest ones are kept; an edge is removed if either of its vertices rejects it. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, ClampMin=1))
+	int32 MaxDegree = 4;
+
+protected:
+	bool IsOverCap(const int32 EdgeIndex, const int32 VertexIndex) const;
+};
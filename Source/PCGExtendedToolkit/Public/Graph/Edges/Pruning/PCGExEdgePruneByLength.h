@@ -0,0 +1,33 @@
+﻿// Copyright Timothé Lapetite 2023
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PCGExEdgePruningOperation.h"
+#include "PCGExEdgePruneByLength.generated.h"
+
+/**
+ * 
+ */
+UCLASS(BlueprintType, DisplayName = "Prune By Length")
+class PCGEXTENDEDTOOLKIT_API UPCGExEdgePruneByLength : public UPCGExEdgePruningOperation
+{
+	GENERATED_BODY()
+
+public:
+	virtual void PrepareForMesh(const PCGExData::FPointIO& PointIO, PCGExMesh::FMesh* Mesh, TArray<bool>* InPruned) override;
+	virtual void ProcessEdge(const int32 EdgeIndex) override;
+
+	/** Edges shorter than the length at this percentile of the mesh are removed. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, ClampMin=0, ClampMax=1))
+	double LowerPercentile = 0;
+
+	/** Edges longer than the length at this percentile of the mesh are removed. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, ClampMin=0, ClampMax=1))
+	double UpperPercentile = 0.95;
+
+protected:
+	double MinLength = 0;
+	double MaxLength = 0;
+};
@@ -0,0 +1,24 @@
+﻿// Copyright Timothé Lapetite 2023
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PCGExEdgePruningOperation.h"
+#include "PCGExEdgePruneDangling.generated.h"
+
+/**
+ * 
+ */
+UCLASS(BlueprintType, DisplayName = "Prune Dangling")
+class PCGEXTENDEDTOOLKIT_API UPCGExEdgePruneDangling : public UPCGExEdgePruningOperation
+{
+	GENERATED_BODY()
+
+public:
+	virtual void PrepareForMesh(const PCGExData::FPointIO& PointIO, PCGExMesh::FMesh* Mesh, TArray<bool>* InPruned) override;
+
+	/** Removes dangling chains by peeling dead-end edges this many times. 0 peels until no dead-end is left. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, ClampMin=0))
+	int32 MaxChainLength = 0;
+};
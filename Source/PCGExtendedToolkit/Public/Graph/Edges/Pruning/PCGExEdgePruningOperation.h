@@ -5,10 +5,18 @@
 
 #include "CoreMinimal.h"
 #include "PCGExOperation.h"
+#include "Data/PCGExPointIO.h"
 #include "PCGExEdgePruningOperation.generated.h"
 
+namespace PCGExMesh
+{
+	struct FMesh;
+}
+
 /**
- * 
+ * Flags mesh edges for removal.
+ * Per-mesh data is gathered in PrepareForMesh, then ProcessEdge is called in parallel for every edge point
+ * and must only write to its own Pruned entry.
  */
 UCLASS(Abstract)
 class PCGEXTENDEDTOOLKIT_API UPCGExEdgePruningOperation : public UPCGExOperation
@@ -16,4 +24,28 @@ class PCGEXTENDEDTOOLKIT_API UPCGExEdgePruningOperation : public UPCGExOperation
 	GENERATED_BODY()
 
 public:
+	/**
+	 * 
+	 * @param PointIO Vertices
+	 * @param Mesh 
+	 * @param InPruned Removal flags, indexed by edge point index. Invalid edges are already flagged.
+	 */
+	virtual void PrepareForMesh(const PCGExData::FPointIO& PointIO, PCGExMesh::FMesh* Mesh, TArray<bool>* InPruned);
+	virtual void ProcessEdge(const int32 EdgeIndex);
+
+	virtual void Cleanup() override;
+
+protected:
+	PCGExMesh::FMesh* CurrentMesh = nullptr;
+	TArray<bool>* Pruned = nullptr;
+
+	TArray<int32> EdgeStartVertex; // Mesh vertex index, per edge point. -1 if invalid
+	TArray<int32> EdgeEndVertex;   // Mesh vertex index, per edge point. -1 if invalid
+	TArray<double> EdgeLengths;    // Per edge point
+
+	bool IsValidEdge(const int32 EdgeIndex) const { return EdgeStartVertex[EdgeIndex] != -1; }
+	int32 GetOtherVertex(const int32 EdgeIndex, const int32 VertexIndex) const
+	{
+		return EdgeStartVertex[EdgeIndex] == VertexIndex ? EdgeEndVertex[EdgeIndex] : EdgeStartVertex[EdgeIndex];
+	}
 };
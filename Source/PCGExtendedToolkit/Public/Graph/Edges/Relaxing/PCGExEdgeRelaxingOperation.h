@@ -32,10 +32,17 @@ public:
 	virtual void PrepareForIteration(int Iteration, TArray<FVector>* PrimaryBuffer, TArray<FVector>* SecondaryBuffer);
 	virtual void ProcessVertex(const PCGExMesh::FVertex& Vertex);
 
+	/** Batched operations process a whole iteration at once through ProcessIteration instead of per-vertex ProcessVertex calls. */
+	virtual bool IsBatched() const { return false; }
+	virtual void ProcessIteration(const bool bParallel);
+
 	virtual void WriteActiveBuffer(PCGExData::FPointIO& PointIO, PCGEx::FLocalSingleFieldGetter& Influence);
 
 	double DefaultInfluence = 1;
 
+	const TArray<FVector>* GetReadBuffer() const { return ReadBuffer; }
+	const TArray<FVector>* GetWriteBuffer() const { return WriteBuffer; }
+
 	virtual void Cleanup() override;
 
 protected:
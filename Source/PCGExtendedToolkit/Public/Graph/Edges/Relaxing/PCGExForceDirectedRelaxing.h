@@ -7,6 +7,61 @@
 #include "PCGExEdgeRelaxingOperation.h"
 #include "PCGExForceDirectedRelaxing.generated.h"
 
+namespace PCGExRelaxing
+{
+	struct PCGEXTENDEDTOOLKIT_API FBarnesHutNode
+	{
+		FVector Center = FVector::ZeroVector;
+		double Extent = 0;
+
+		FVector CenterOfMass = FVector::ZeroVector;
+		int32 Mass = 0;
+
+		int32 FirstChild = -1; // First of 8 contiguous children, -1 if leaf
+		int32 Start = 0;       // Items range
+		int32 Count = 0;
+	};
+
+	/**
+	 * Flat Barnes-Hut octree over a set of positions.
+	 * The root is split serially, then each octant subtree is built in parallel and spliced back.
+	 */
+	struct PCGEXTENDEDTOOLKIT_API FBarnesHutTree
+	{
+		int32 LeafSize = 8;
+		int32 MaxDepth = 16;
+
+		TArray<FBarnesHutNode> Nodes;
+		TArray<int32> Items; // Position indices, grouped by leaf
+
+		~FBarnesHutTree()
+		{
+			Nodes.Empty();
+			Items.Empty();
+			Positions = nullptr;
+		}
+
+		void Build(const TArray<FVector>& InPositions, const bool bParallel);
+
+		/**
+		 * Accumulate Coulomb-like repulsion from every other item, approximating distant cells by their center of mass.
+		 * @param Force Force to add to
+		 * @param Item Index of the item being processed, ignored during accumulation
+		 * @param Position 
+		 * @param Strength 
+		 * @param Theta Opening criterion. 0 = exact, higher = faster & coarser.
+		 */
+		void AccumulateRepulsion(FVector& Force, const int32 Item, const FVector& Position, const double Strength, const double Theta) const;
+
+	protected:
+		const TArray<FVector>* Positions = nullptr;
+
+		void Split(TArray<FBarnesHutNode>& InNodes, const int32 NodeIndex);
+		void BuildRecursive(TArray<FBarnesHutNode>& InNodes, const int32 NodeIndex, const int32 Depth);
+		void UpdateMass(TArray<FBarnesHutNode>& InNodes, const int32 NodeIndex) const;
+	};
+}
+
 /**
  * 
  */
@@ -16,6 +71,7 @@ class PCGEXTENDEDTOOLKIT_API UPCGExForceDirectedRelaxing : public UPCGExEdgeRela
 	GENERATED_BODY()
 
 public:
+	virtual void PrepareForIteration(int Iteration, TArray<FVector>* PrimaryBuffer, TArray<FVector>* SecondaryBuffer) override;
 	virtual void ProcessVertex(const PCGExMesh::FVertex& Vertex) override;
 
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable))
@@ -24,7 +80,20 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable))
 	double ElectrostaticConstant = 1000;
 
+	/** If enabled, vertices are repulsed by every other vertex in the cluster using a Barnes-Hut approximation, instead of their direct neighbors only. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, InlineEditConditionToggle))
+	bool bGlobalRepulsion = false;
+
+	/** Barnes-Hut opening angle. Lower is more accurate, higher is faster. 0 falls back to exact all-pairs repulsion. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, EditCondition="bGlobalRepulsion", ClampMin=0, ClampMax=2))
+	double Theta = 0.5;
+
+	virtual void Cleanup() override;
+
 protected:
+	PCGExRelaxing::FBarnesHutTree RepulsionTree;
+	TArray<FVector> VertexPositions;
+
 	void CalculateAttractiveForce(FVector& Force, const FVector& A, const FVector& B) const;
 	void CalculateRepulsiveForce(FVector& Force, const FVector& A, const FVector& B) const;
 };
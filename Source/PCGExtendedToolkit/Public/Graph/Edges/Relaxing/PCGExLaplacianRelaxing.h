@@ -0,0 +1,54 @@
+﻿// Copyright Timothé Lapetite 2023
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PCGExEdgeRelaxingOperation.h"
+#include "PCGExLaplacianRelaxing.generated.h"
+
+/**
+ * Laplacian/Taubin smoothing over SoA positions & CSR adjacency, processed one full iteration at a time.
+ */
+UCLASS(DisplayName = "Laplacian")
+class PCGEXTENDEDTOOLKIT_API UPCGExLaplacianRelaxing : public UPCGExEdgeRelaxingOperation
+{
+	GENERATED_BODY()
+
+public:
+	virtual void PrepareForMesh(PCGExData::FPointIO& EdgesIO, PCGExMesh::FMesh* Mesh) override;
+	virtual void PrepareForIteration(int Iteration, TArray<FVector>* PrimaryBuffer, TArray<FVector>* SecondaryBuffer) override;
+
+	virtual bool IsBatched() const override { return true; }
+	virtual void ProcessIteration(const bool bParallel) override;
+
+	/** How far each iteration moves vertices toward the average of their neighbors. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, ClampMin=0, ClampMax=1))
+	double Lambda = 0.5;
+
+	/** Alternate shrinking and inflating steps (Taubin smoothing) so the cluster doesn't collapse onto itself. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, InlineEditConditionToggle))
+	bool bTaubin = false;
+
+	/** Inflating factor used on odd iterations. Should be negative and of slightly greater magnitude than Lambda. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, EditCondition="bTaubin", ClampMin=-1, ClampMax=0))
+	double Mu = -0.53;
+
+	virtual void Cleanup() override;
+
+protected:
+	bool bLoadPositions = false;
+
+	TArray<int32> PointIndices; // Mesh vertex -> point index
+	TArray<int32> AdjacencyOffsets;
+	TArray<int32> Adjacency;
+	TArray<double> InvDegrees;
+
+	TArray<double> X;
+	TArray<double> Y;
+	TArray<double> Z;
+
+	TArray<double> NextX;
+	TArray<double> NextY;
+	TArray<double> NextZ;
+};
@@ -0,0 +1,92 @@
+﻿// Copyright Timothé Lapetite 2023
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "PCGExEdgesBuilder.h"
+
+#include "PCGExBuildDelaunayGraph.generated.h"
+
+UENUM(BlueprintType)
+enum class EPCGExDelaunayGraphType : uint8
+{
+	Delaunay UMETA(DisplayName = "Delaunay", ToolTip="Keep every edge of the triangulation."),
+	Gabriel UMETA(DisplayName = "Gabriel", ToolTip="Only keep edges whose diametral sphere contains no other point."),
+	RelativeNeighborhood UMETA(DisplayName = "Relative Neighborhood", ToolTip="Only keep edges with no other point closer to both ends than they are to each other."),
+	Urquhart UMETA(DisplayName = "Urquhart", ToolTip="Remove the longest edge of each triangle."),
+};
+
+/**
+ * Builds a Delaunay graph from input points, and output edges right away.
+ */
+UCLASS(BlueprintType, ClassGroup = (Procedural), Category="PCGEx|Graph")
+class PCGEXTENDEDTOOLKIT_API UPCGExBuildDelaunayGraphSettings : public UPCGExEdgesBuilderSettings
+{
+	GENERATED_BODY()
+
+public:
+	//~Begin UPCGSettings interface
+#if WITH_EDITOR
+	PCGEX_NODE_INFOS(BuildDelaunayGraph, "Graph : Delaunay", "Create a Delaunay graph for each input points, optionally pruned down to a Gabriel, Relative Neighborhood or Urquhart graph.");
+#endif
+
+protected:
+	virtual FPCGElementPtr CreateElement() const override;
+	//~End UPCGSettings interface
+
+public:
+	/** Tetrahedralize points in 3D instead of triangulating them on a projection plane. Flat inputs fall back to the projection plane. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable))
+	bool b3D = false;
+
+	/** Normal of the plane points are projected on before being triangulated. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable))
+	FVector ProjectionNormal = FVector::UpVector;
+
+	/** Which subgraph of the triangulation to output. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable))
+	EPCGExDelaunayGraphType GraphType = EPCGExDelaunayGraphType::Delaunay;
+
+private:
+	friend class FPCGExBuildDelaunayGraphElement;
+};
+
+struct PCGEXTENDEDTOOLKIT_API FPCGExBuildDelaunayGraphContext : public FPCGExEdgesBuilderContext
+{
+	friend class FPCGExBuildDelaunayGraphElement;
+
+	virtual ~FPCGExBuildDelaunayGraphContext() override;
+
+	bool b3D;
+	FVector ProjectionNormal;
+	EPCGExDelaunayGraphType GraphType;
+
+	TArray<int32> NumSkippedSites; // Per input, points the 3D triangulation failed to insert
+};
+
+class PCGEXTENDEDTOOLKIT_API FPCGExBuildDelaunayGraphElement : public FPCGExEdgesBuilderElement
+{
+public:
+	virtual FPCGContext* Initialize(
+		const FPCGDataCollection& InputData,
+		TWeakObjectPtr<UPCGComponent> SourceComponent,
+		const UPCGNode* Node) override;
+
+protected:
+	virtual bool Boot(FPCGContext* InContext) const override;
+	virtual void StartBuildTask(FPCGExEdgesBuilderContext* InContext, PCGExData::FPointIO& PointIO, const int32 Index) const override;
+	virtual void OnBuildComplete(FPCGExEdgesBuilderContext* InContext) const override;
+};
+
+class PCGEXTENDEDTOOLKIT_API FPCGExDelaunayGraphTask : public FPCGExNonAbandonableTask
+{
+public:
+	FPCGExDelaunayGraphTask(FPCGExAsyncManager* InManager, const int32 InTaskIndex, PCGExData::FPointIO* InPointIO) :
+		FPCGExNonAbandonableTask(InManager, InTaskIndex, InPointIO)
+	{
+	}
+
+	virtual bool ExecuteTask() override;
+};
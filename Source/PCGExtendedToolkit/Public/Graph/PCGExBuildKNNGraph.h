@@ -0,0 +1,77 @@
+﻿// Copyright Timothé Lapetite 2023
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "PCGExEdgesBuilder.h"
+
+#include "PCGExBuildKNNGraph.generated.h"
+
+/**
+ * Connects each point to its K nearest neighbors, and output edges right away.
+ */
+UCLASS(BlueprintType, ClassGroup = (Procedural), Category="PCGEx|Graph")
+class PCGEXTENDEDTOOLKIT_API UPCGExBuildKNNGraphSettings : public UPCGExEdgesBuilderSettings
+{
+	GENERATED_BODY()
+
+public:
+	//~Begin UPCGSettings interface
+#if WITH_EDITOR
+	PCGEX_NODE_INFOS(BuildKNNGraph, "Graph : K-Nearest", "Connect each point to its K nearest neighbors, optionally within a maximum distance.");
+#endif
+
+protected:
+	virtual FPCGElementPtr CreateElement() const override;
+	//~End UPCGSettings interface
+
+public:
+	/** Number of neighbors each point connects to. Points may end up with more edges, as connections are undirected. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, ClampMin=1))
+	int32 K = 6;
+
+	/** Only connect neighbors within a maximum distance. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable, InlineEditConditionToggle))
+	bool bUseMaxDistance = false;
+
+	/** Maximum distance to a neighbor. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable, EditCondition="bUseMaxDistance", ClampMin=0.001))
+	double MaxDistance = 100;
+
+private:
+	friend class FPCGExBuildKNNGraphElement;
+};
+
+struct PCGEXTENDEDTOOLKIT_API FPCGExBuildKNNGraphContext : public FPCGExEdgesBuilderContext
+{
+	friend class FPCGExBuildKNNGraphElement;
+
+	int32 K;
+	double MaxDistanceSquared;
+};
+
+class PCGEXTENDEDTOOLKIT_API FPCGExBuildKNNGraphElement : public FPCGExEdgesBuilderElement
+{
+public:
+	virtual FPCGContext* Initialize(
+		const FPCGDataCollection& InputData,
+		TWeakObjectPtr<UPCGComponent> SourceComponent,
+		const UPCGNode* Node) override;
+
+protected:
+	virtual bool Boot(FPCGContext* InContext) const override;
+	virtual void StartBuildTask(FPCGExEdgesBuilderContext* InContext, PCGExData::FPointIO& PointIO, const int32 Index) const override;
+};
+
+class PCGEXTENDEDTOOLKIT_API FPCGExKNNGraphTask : public FPCGExNonAbandonableTask
+{
+public:
+	FPCGExKNNGraphTask(FPCGExAsyncManager* InManager, const int32 InTaskIndex, PCGExData::FPointIO* InPointIO) :
+		FPCGExNonAbandonableTask(InManager, InTaskIndex, InPointIO)
+	{
+	}
+
+	virtual bool ExecuteTask() override;
+};
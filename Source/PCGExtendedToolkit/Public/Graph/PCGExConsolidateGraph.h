@@ -48,8 +48,9 @@ struct PCGEXTENDEDTOOLKIT_API FPCGExConsolidateGraphContext : public FPCGExGraph
 public:
 	bool bConsolidateEdgeType;
 
-	TMap<int64, int64> IndicesRemap;
-	mutable FRWLock IndicesLock;
+	TArray<int32> IndicesRemap; // Dense, previous index -> current index, -1 if the point has been removed
+
+	int32 GetFixedIndex(const int32 InIndex) const { return IndicesRemap.IsValidIndex(InIndex) ? IndicesRemap[InIndex] : -1; }
 };
 
 
@@ -64,7 +65,4 @@ public:
 protected:
 	virtual bool Boot(FPCGContext* InContext) const override;
 	virtual bool ExecuteInternal(FPCGContext* InContext) const override;
-#if WITH_EDITOR
-	static int64 GetFixedIndex(FPCGExConsolidateGraphContext* Context, int64 InIndex);
-#endif
 };
@@ -122,4 +122,58 @@ namespace PCGExGraph
 		}
 	};
 
+	/**
+	 * Concurrent set of unique unsigned edges.
+	 * Edges are distributed over independently locked shards based on their unsigned hash,
+	 * so threads inserting different edges rarely contend on the same lock.
+	 */
+	struct PCGEXTENDEDTOOLKIT_API FEdgeSet
+	{
+		static constexpr int32 NumShardsBits = 6;
+		static constexpr int32 NumShards = 1 << NumShardsBits;
+
+		FEdgeSet()
+		{
+		}
+
+		~FEdgeSet()
+		{
+			Reset();
+		}
+
+		/**
+		 * Empty the set and reserve an estimated amount of edges, spread across shards
+		 * @param InNumEdgesReserve 
+		 */
+		void Reset(const int32 InNumEdgesReserve = 0);
+
+		/**
+		 * Thread-safe.
+		 * @param Edge 
+		 * @return true if the edge was not already in the set
+		 */
+		bool Add(const FUnsignedEdge& Edge);
+
+		int32 Num() const;
+
+		/**
+		 * Gather all unique edges, sorted by unsigned hash so the output order
+		 * doesn't depend on insertion order.
+		 * Not thread-safe, must be called once all insertions are complete.
+		 * @param OutEdges 
+		 */
+		void Gather(TArray<FUnsignedEdge>& OutEdges) const;
+
+	protected:
+		struct FShard
+		{
+			mutable FRWLock Lock;
+			TSet<uint64> Hashes;
+			TArray<FUnsignedEdge> Edges;
+		};
+
+		FShard Shards[NumShards];
+
+		static int32 GetShardIndex(const uint64 Hash) { return static_cast<int32>((Hash * 0x9E3779B97F4A7C15ull) >> (64 - NumShardsBits)); }
+	};
 }
@@ -0,0 +1,74 @@
+﻿// Copyright Timothé Lapetite 2023
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "PCGExPointsProcessor.h"
+#include "Data/PCGExData.h"
+#include "Graph/PCGExEdge.h"
+
+#include "PCGExEdgesBuilder.generated.h"
+
+/**
+ * A base node building edges out of each input points on its own, and outputting them as clusters right away.
+ */
+UCLASS(Abstract, BlueprintType, ClassGroup = (Procedural), Category="PCGEx|Graph")
+class PCGEXTENDEDTOOLKIT_API UPCGExEdgesBuilderSettings : public UPCGExPointsProcessorSettings
+{
+	GENERATED_BODY()
+
+public:
+	//~Begin UPCGSettings interface
+#if WITH_EDITOR
+	PCGEX_NODE_INFOS(EdgesBuilderSettings, "Edges Builder Settings", "TOOLTIP_TEXT");
+#endif
+	virtual TArray<FPCGPinProperties> OutputPinProperties() const override;
+	//~End UPCGSettings interface
+
+	//~Begin UPCGExPointsProcessorSettings interface
+public:
+	virtual FName GetMainOutputLabel() const override;
+	virtual PCGExData::EInit GetMainOutputInitMode() const override;
+	//~End UPCGExPointsProcessorSettings interface
+};
+
+struct PCGEXTENDEDTOOLKIT_API FPCGExEdgesBuilderContext : public FPCGExPointsProcessorContext
+{
+	friend class FPCGExEdgesBuilderElement;
+
+	virtual ~FPCGExEdgesBuilderContext() override;
+
+	PCGExData::FPointIOGroup* EdgesIO = nullptr;
+	TArray<PCGExData::FKPointIOMarkedBindings<int32>> Markings; // One per input, bound to the edges of each of its islands
+
+	/**
+	 * Split edges into connected islands, and write each of them to its own cluster edges output bound to the input points.
+	 * Safe to call from the task building the given input.
+	 * @param InputIndex Index of the input points in MainPoints
+	 * @param PointIO Input points, edges indices refer to its output points
+	 * @param Edges Unique edges
+	 */
+	void WriteIslands(const int32 InputIndex, const PCGExData::FPointIO& PointIO, const TArray<PCGExGraph::FUnsignedEdge>& Edges);
+};
+
+class PCGEXTENDEDTOOLKIT_API FPCGExEdgesBuilderElement : public FPCGExPointsProcessorElementBase
+{
+protected:
+	virtual bool Boot(FPCGContext* InContext) const override;
+	virtual bool ExecuteInternal(FPCGContext* InContext) const override;
+
+	/**
+	 * Start building edges for a single input, with at least two points. The task is expected to end with Context->WriteIslands.
+	 * @param InContext Context of the executing element
+	 * @param PointIO Input points to build edges from
+	 * @param Index Index of the input in MainPoints
+	 */
+	virtual void StartBuildTask(FPCGExEdgesBuilderContext* InContext, PCGExData::FPointIO& PointIO, const int32 Index) const = 0;
+
+	/** Called once every input has been processed, before outputs are written. */
+	virtual void OnBuildComplete(FPCGExEdgesBuilderContext* InContext) const
+	{
+	}
+};
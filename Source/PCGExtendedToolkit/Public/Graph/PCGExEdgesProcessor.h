@@ -57,7 +57,13 @@ struct PCGEXTENDEDTOOLKIT_API FPCGExEdgesProcessorContext : public FPCGExPointsP
 
 	PCGExData::FPointIO* CurrentEdges = nullptr;
 	bool AdvanceAndBindPointsIO();
-	bool AdvanceEdges(); // Advance edges within current points
+
+	/**
+	 * Advance to the next edges bound to the current points, as gathered by AdvanceAndBindPointsIO.
+	 * Edges inputs whose PUID does not match the current points are skipped, as their indices would refer to other vertices.
+	 * @return false once all bound edges have been visited
+	 */
+	bool AdvanceEdges();
 
 	bool bCacheAllMeshes = false;
 	PCGExMesh::FMesh* CurrentMesh = nullptr;
@@ -403,6 +403,7 @@ namespace PCGExGraph
 		void SetEdgeType(const int32 PointIndex, EPCGExEdgeType InEdgeType) const;
 		EPCGExEdgeType GetEdgeType(const int32 PointIndex) const;
 		FSocketMetadata GetData(const int32 PointIndex) const;
+		const TArray<int32>& GetTargetIndices() const { return bReadOnly ? TargetIndexReader->GetValues() : TargetIndexWriter->Values; }
 
 		template <typename T>
 		bool TryGetEdge(const int32 PointIndex, T& OutEdge) const
@@ -468,6 +469,7 @@ namespace PCGExGraph
 		TArray<FProbeDistanceModifier> Modifiers;
 		TArray<FLocalDirection> LocalDirections;
 		TMap<FName, int32> NameToIndexMap;
+		TArray<EPCGExEdgeType> EdgeTypeTable; // NumSockets * NumSockets, [StartSocket][EndSocket]
 		int32 NumSockets = 0;
 
 		void Initialize(const FName InIdentifier, TArray<FPCGExSocketDescriptor>& InSockets);
@@ -487,12 +489,32 @@ namespace PCGExGraph
 		const TArray<FProbeDistanceModifier>& GetModifiers() const { return Modifiers; }
 
 		void GetSocketsInfos(TArray<FSocketInfos>& OutInfos);
+
+		EPCGExEdgeType GetEdgeType(const int32 StartSocketIndex, const int32 EndSocketIndex) const { return EdgeTypeTable[StartSocketIndex * NumSockets + EndSocketIndex]; }
+
+		/**
+		 * Copy each socket' target indices into a single point-major array,
+		 * so that all the targets of a given point are contiguous in memory.
+		 * Sockets must have been prepared for the point data beforehand.
+		 * @param NumPoints 
+		 * @param OutPackedTargets Point-major array of size NumPoints * NumSockets
+		 */
+		void PackTargetIndices(const int32 NumPoints, TArray<int32>& OutPackedTargets) const;
+
+		/**
+		 * Compute & write the edge type of each socket of a given point, using packed target indices
+		 * and the precomputed edge type table. Safe to call in parallel for different points.
+		 * @param PackedTargets Output of PackTargetIndices
+		 * @param PointIndex 
+		 */
+		void ComputeEdgeType(const TArray<int32>& PackedTargets, const int32 PointIndex) const;
+
 		void Cleanup();
 		void Reset();
 
 	private:
 		/**
-		 * Build matching set
+		 * Build matching set & edge type table
 		 */
 		void PostProcessSockets();
 	};
@@ -537,31 +559,6 @@ namespace PCGExGraph
 		return EPCGExEdgeType::Shared;
 	}
 
-	static void ComputeEdgeType(const TArray<FSocketInfos>& SocketInfos, const int32 PointIndex)
-	{
-		for (const FSocketInfos& CurrentSocketInfos : SocketInfos)
-		{
-			EPCGExEdgeType Type = EPCGExEdgeType::Unknown;
-			const int64 RelationIndex = CurrentSocketInfos.Socket->GetTargetIndex(PointIndex);
-
-			if (RelationIndex != -1)
-			{
-				for (const FSocketInfos& OtherSocketInfos : SocketInfos)
-				{
-					if (OtherSocketInfos.Socket->GetTargetIndex(RelationIndex) == PointIndex)
-					{
-						Type = GetEdgeType(CurrentSocketInfos, OtherSocketInfos);
-					}
-				}
-
-				if (Type == EPCGExEdgeType::Unknown) { Type = EPCGExEdgeType::Roaming; }
-			}
-
-
-			CurrentSocketInfos.Socket->SetEdgeType(PointIndex, Type);
-		}
-	}
-
 #pragma endregion
 
 #pragma region Network
@@ -671,6 +668,16 @@ namespace PCGExGraph
 		void ProcessEdge(const int32 EdgeIndex, const TArray<FPCGPoint>& InPoints);
 		void InsertCrossings();
 	};
+
+	/**
+	 * Write a flat list of unique edges to an edges output, one point per edge.
+	 * The matching cluster topology is attached when the output is cluster data.
+	 * @param EdgesIO Output to write edges to
+	 * @param Vertices Points the edges indices refer to
+	 * @param Edges Edges to write, in output order
+	 * @param IslandID Island identifier stored on the attached topology
+	 */
+	PCGEXTENDEDTOOLKIT_API void WriteEdges(PCGExData::FPointIO& EdgesIO, const TArray<FPCGPoint>& Vertices, const TArray<FUnsignedEdge>& Edges, const int32 IslandID = 0);
 #pragma endregion
 }
 
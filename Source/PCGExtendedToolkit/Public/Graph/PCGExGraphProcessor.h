@@ -60,6 +60,14 @@ struct PCGEXTENDEDTOOLKIT_API FPCGExGraphProcessorContext : public FPCGExPointsP
 	TArray<PCGExGraph::FSocketInfos> SocketInfos;
 
 	void PrepareCurrentGraphForPoints(const PCGExData::FPointIO& PointIO, const bool ReadOnly = true);
+
+	/**
+	 * Pack current graph' socket targets for the given points, required before calling ComputeEdgeType.
+	 * Current graph must have been prepared in write mode.
+	 * @param PointIO 
+	 */
+	void PrepareEdgeTypes(const PCGExData::FPointIO& PointIO);
+	void ComputeEdgeType(const int32 PointIndex) const;
 	void OutputGraphParams() { Graphs.OutputTo(this); }
 
 	void OutputPointsAndGraphParams()
@@ -71,6 +79,7 @@ struct PCGEXTENDEDTOOLKIT_API FPCGExGraphProcessorContext : public FPCGExPointsP
 protected:
 	PCGEx::TFAttributeReader<int32>* CachedIndexReader = nullptr;
 	PCGEx::TFAttributeWriter<int32>* CachedIndexWriter = nullptr;
+	TArray<int32> PackedTargetIndices;
 	int32 CurrentParamsIndex = -1;
 };
 
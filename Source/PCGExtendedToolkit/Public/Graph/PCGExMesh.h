@@ -9,6 +9,47 @@
 
 namespace PCGExMesh
 {
+	/**
+	 * Compact, read-only cluster topology.
+	 * Vertices are ordered by first appearance in the edge list; adjacency is stored as CSR,
+	 * with neighbors and edges in separate ranges since parallel edges share a neighbor.
+	 */
+	struct PCGEXTENDEDTOOLKIT_API FClusterTopology
+	{
+		int32 IslandID = -1;
+		int32 NumVertexPoints = 0; // Number of points in the vertex data this topology indexes into
+		bool bHasInvalidEdges = false;
+
+		TArray<int32> EdgeStart; // Start vertex point index, per edge point
+		TArray<int32> EdgeEnd;   // End vertex point index, per edge point
+
+		TArray<int32> VertexPointIndices; // Mesh vertex -> vertex point index
+		TArray<int32> NeighborOffsets;    // NumVertices + 1
+		TArray<int32> Neighbors;          // Mesh vertex indices
+		TArray<int32> EdgeOffsets;        // NumVertices + 1
+		TArray<int32> Edges;              // Edge point indices
+
+		/**
+		 * Build adjacency from EdgeStart/EdgeEnd, which must be filled beforehand.
+		 * @param InNumVertexPoints Number of points in the vertex data
+		 */
+		void Build(const int32 InNumVertexPoints);
+
+		int32 NumVertices() const { return VertexPointIndices.Num(); }
+		int32 NumEdges() const { return EdgeStart.Num(); }
+
+		bool IsValidEdge(const int32 EdgeIndex) const
+		{
+			return EdgeStart[EdgeIndex] >= 0 && EdgeStart[EdgeIndex] < NumVertexPoints &&
+				EdgeEnd[EdgeIndex] >= 0 && EdgeEnd[EdgeIndex] < NumVertexPoints;
+		}
+
+		bool IsCompatible(const int32 InNumVertexPoints, const int32 InNumEdges) const
+		{
+			return NumVertexPoints == InNumVertexPoints && EdgeStart.Num() == InNumEdges;
+		}
+	};
+
 	struct PCGEXTENDEDTOOLKIT_API FIndexedEdge : public PCGExGraph::FUnsignedEdge
 	{
 		int32 Index = -1;
@@ -76,7 +117,14 @@ namespace PCGExMesh
 
 		~FMesh();
 
+		/**
+		 * Build the mesh from the cluster topology attached to the edges data if there is a valid one,
+		 * otherwise decode EdgeStart/EdgeEnd attributes.
+		 * @param InPoints 
+		 * @param InEdges 
+		 */
 		void BuildFrom(const PCGExData::FPointIO& InPoints, const PCGExData::FPointIO& InEdges);
+		void BuildFrom(const FClusterTopology& InTopology, const PCGExData::FPointIO& InPoints);
 		int32 FindClosestVertex(const FVector& Position) const;
 
 		const FVertex& GetVertexFromPointIndex(const int32 Index) const;
@@ -86,6 +134,5 @@ namespace PCGExMesh
 
 	protected:
 		bool bHasInvalidEdges = false;
-		FVertex& GetOrCreateVertex(const int32 PointIndex, bool& bJustCreated);
 	};
 }
@@ -268,11 +268,12 @@ namespace PCGExPathfinding
 			}, SeedIO->GetNum());
 	}
 
+	template <typename AllocatorType = FDefaultAllocator>
 	static bool FindPath(
 		const PCGExMesh::FMesh* Mesh,
 		const int32 Seed, const int32 Goal,
 		const UPCGExHeuristicOperation* Heuristics,
-		const FPCGExHeuristicModifiersSettings* Modifiers, TArray<int32>& OutPath)
+		const FPCGExHeuristicModifiersSettings* Modifiers, TArray<int32, AllocatorType>& OutPath)
 	{
 		if (Seed == Goal) { return false; }
 
@@ -305,7 +306,7 @@ namespace PCGExPathfinding
 			if (CurrentVtxIndex == EndVtx.MeshIndex)
 			{
 				bSuccess = true;
-				TArray<int32> Path;
+				TArray<int32, AllocatorType> Path;
 
 				while (CurrentWVtx)
 				{
@@ -351,10 +352,11 @@ namespace PCGExPathfinding
 		return bSuccess;
 	}
 
+	template <typename AllocatorType = FDefaultAllocator>
 	static bool FindPath(
 		const PCGExMesh::FMesh* Mesh, const FVector& SeedPosition, const FVector& GoalPosition,
 		const UPCGExHeuristicOperation* Heuristics,
-		const FPCGExHeuristicModifiersSettings* Modifiers, TArray<int32>& OutPath)
+		const FPCGExHeuristicModifiersSettings* Modifiers, TArray<int32, AllocatorType>& OutPath)
 	{
 		return FindPath(
 			Mesh,
@@ -364,19 +366,21 @@ namespace PCGExPathfinding
 	}
 
 
+	template <typename AllocatorType = FDefaultAllocator>
 	static bool ContinuePath(
 		const PCGExMesh::FMesh* Mesh, const int32 To,
 		const UPCGExHeuristicOperation* Heuristics,
-		const FPCGExHeuristicModifiersSettings* Modifiers, TArray<int32>& OutPath)
+		const FPCGExHeuristicModifiersSettings* Modifiers, TArray<int32, AllocatorType>& OutPath)
 	{
 		return FindPath(Mesh, OutPath.Last(), To, Heuristics, Modifiers, OutPath);
 	}
 
 
+	template <typename AllocatorType = FDefaultAllocator>
 	static bool ContinuePath(
 		const PCGExMesh::FMesh* Mesh, const FVector& To,
 		const UPCGExHeuristicOperation* Heuristics,
-		const FPCGExHeuristicModifiersSettings* Modifiers, TArray<int32>& OutPath)
+		const FPCGExHeuristicModifiersSettings* Modifiers, TArray<int32, AllocatorType>& OutPath)
 	{
 		return ContinuePath(Mesh, Mesh->FindClosestVertex(To), Heuristics, Modifiers, OutPath);
 	}
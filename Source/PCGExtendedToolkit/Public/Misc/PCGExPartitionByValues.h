@@ -16,12 +16,12 @@ namespace PCGExPartition
 
 	class FKPartition;
 
+	/**
+	 * Partition tree node. Leaves own a contiguous range of the sorted point order built by Distribute.
+	 * The tree is not thread-safe; it is only grown serially from per-thread buckets.
+	 */
 	class PCGEXTENDEDTOOLKIT_API FKPartition
 	{
-	protected:
-		mutable FRWLock LayersLock;
-		mutable FRWLock PointLock;
-
 	public:
 		FKPartition(FKPartition* InParent, int64 InKey, FPCGExFilter::FRule* InRule);
 		~FKPartition();
@@ -31,14 +31,29 @@ namespace PCGExPartition
 		FPCGExFilter::FRule* Rule = nullptr;
 
 		TMap<int64, FKPartition*> SubLayers;
-		TArray<int32> Points;
+		int32 FirstIndex = 0;
+		int32 NumPoints = 0;
 
-		int32 GetNum() const { return Points.Num(); }
+		int32 GetNum() const { return NumPoints; }
 		int32 GetSubPartitionsNum();
 
 		FKPartition* GetPartition(int64 Key, FPCGExFilter::FRule* InRule);
-		void Add(const int64 Index);
 		void Register(TArray<FKPartition*>& Partitions);
+
+		/**
+		 * Two-pass, lock-free partitioning of all points.
+		 * Each chunk of points first gathers its own key -> bucket map, local buckets are then merged into the tree,
+		 * and points are scattered (counting-sort) into OutPointOrder so each leaf owns [FirstIndex, FirstIndex + NumPoints[.
+		 * @param Rules Partition rules, one tree level each
+		 * @param Keys Per-point keys, Rules.Num() consecutive keys per point
+		 * @param InNumPoints Number of points to partition, Keys holds Rules.Num() keys for each of them
+		 * @param OutPartitions Leaves, in tree order
+		 * @param OutPointOrder Point indices sorted by partition
+		 * @param bParallel Whether point chunks are bucketed and scattered in parallel; results are identical either way
+		 */
+		void Distribute(
+			TArray<FPCGExFilter::FRule>& Rules, const TArray<int64>& Keys, const int32 InNumPoints,
+			TArray<FKPartition*>& OutPartitions, TArray<int32>& OutPointOrder, const bool bParallel = true);
 	};
 }
 
@@ -100,6 +115,7 @@ struct PCGEXTENDEDTOOLKIT_API FPCGExPartitionByValuesContext : public FPCGExPoin
 
 	int32 NumPartitions = -1;
 	TArray<PCGExPartition::FKPartition*> Partitions;
+	TArray<int32> PartitionedPoints;
 };
 
 class PCGEXTENDEDTOOLKIT_API FPCGExPartitionByValuesElement : public FPCGExPointsProcessorElementBase
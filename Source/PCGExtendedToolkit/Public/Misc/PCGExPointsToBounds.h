@@ -66,6 +66,10 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings)
 	FPCGExBlendingSettings BlendingSettings;
 
+	/** Output an oriented bounding box aligned on the principal axes of the points, instead of a world-aligned one. Usually tighter around elongated or slanted groups. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings)
+	bool bOrientedBounds = false;
+
 	/** Write point counts */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(InlineEditConditionToggle))
 	bool bWritePointsCount = false;
@@ -6,6 +6,7 @@
 #include "PCGContext.h"
 #include "Data/PCGExPointIO.h"
 #include "Helpers/PCGAsync.h"
+#include "Misc/MemStack.h"
 
 namespace PCGExMT
 {
@@ -17,6 +18,24 @@ namespace PCGExMT
 	constexpr AsyncState State_WaitingOnAsyncWork = __COUNTER__;
 	constexpr AsyncState State_Done = __COUNTER__;
 
+	/**
+	 * Array allocated from the executing thread's scratch arena instead of the global heap.
+	 * Everything allocated this way inside FPCGExNonAbandonableTask::ExecuteTask is released at once when the task returns,
+	 * so these must only be used as locals of ExecuteTask, on the task's own thread (not inside nested ParallelFor bodies).
+	 */
+	template <typename T>
+	using TScratchArray = TArray<T, TMemStackAllocator<>>;
+
+	/**
+	 * Batch size that splits NumIterations into a few batches per worker thread, for load balancing,
+	 * without going below MinBatchSize.
+	 */
+	static int32 GetBatchSize(const int32 NumIterations, const int32 MinBatchSize)
+	{
+		const int32 NumBatches = FMath::Max(1, FPlatformMisc::NumberOfWorkerThreadsToSpawn() * 4);
+		return FMath::Max3(1, MinBatchSize, FMath::DivideAndRoundUp(NumIterations, NumBatches));
+	}
+
 	struct PCGEXTENDEDTOOLKIT_API FChunkedLoop
 	{
 		FChunkedLoop()
@@ -256,6 +275,30 @@ public:
 		StartSync(new FAsyncTask<T>(this, Index, InPointsIO, args...));
 	}
 
+	/**
+	 * Run RunIndex over [0, NumIterations[ from a handful of range tasks, each looping over a contiguous batch of indices.
+	 * Prefer this over one Start per point/query : a task costs an allocation, a lock and a thread pool submission.
+	 * @param NumIterations
+	 * @param MinBatchSize Batches grow so only a few are scheduled per worker thread, but are never smaller than this.
+	 * @param RunIndex Signature: bool(int32 Index). Called from worker threads.
+	 */
+	void StartRanges(const int32 NumIterations, const int32 MinBatchSize, TFunction<bool(int32)>&& RunIndex);
+
+	/**
+	 * StartRanges flavor running a T task per index : each T is built on the range task's stack and executed in place,
+	 * rather than scheduled on its own. T must be constructible from (Manager, Index, PointIO, args...).
+	 */
+	template <typename T, typename... Args>
+	void StartRanges(const int32 NumIterations, const int32 MinBatchSize, PCGExData::FPointIO* InPointsIO, Args... args)
+	{
+		StartRanges(
+			NumIterations, MinBatchSize, [this, InPointsIO, args...](const int32 Index)
+			{
+				T Task(this, Index, InPointsIO, args...);
+				return Task.ExecuteTask();
+			});
+	}
+
 	void Reserve(const int32 NumTasks) { QueuedTasks.Reserve(NumTasks); }
 
 	void OnAsyncTaskExecutionComplete(FPCGExNonAbandonableTask* AsyncTask, bool bSuccess);
@@ -300,12 +343,42 @@ public:
 		if (bWorkDone) { return; }
 		PCGEX_ASYNC_CHECKPOINT_VOID
 		bWorkDone = true;
-		Manager->OnAsyncTaskExecutionComplete(this, ExecuteTask());
+
+		bool bSuccess;
+		{
+			// Rewinds the thread scratch arena once the task is done, see PCGExMT::TScratchArray
+			FMemMark ScratchMark(GetScratch());
+			bSuccess = ExecuteTask();
+		}
+
+		Manager->OnAsyncTaskExecutionComplete(this, bSuccess);
 	}
 
+	/** Thread-local bump allocator, rewound after each task. Prefer PCGExMT::TScratchArray for temporary arrays. */
+	static FMemStack& GetScratch() { return FMemStack::Get(); }
+
 	virtual bool ExecuteTask() = 0;
 
 protected:
 	bool bWorkDone = false;
 	bool Checkpoint() const { return !(!Manager || Manager->bStopped || Manager->bFlushing); }
 };
+
+/**
+ * Runs a contiguous batch of indices [TaskIndex, TaskIndex + Count[ in a single task, see FPCGExAsyncManager::StartRanges.
+ */
+class PCGEXTENDEDTOOLKIT_API FPCGExRangeTask final : public FPCGExNonAbandonableTask
+{
+public:
+	FPCGExRangeTask(FPCGExAsyncManager* InManager, const int32 InTaskIndex, PCGExData::FPointIO* InPointIO,
+	                const int32 InCount, const TFunction<bool(int32)>& InRunIndex) :
+		FPCGExNonAbandonableTask(InManager, InTaskIndex, InPointIO),
+		Count(InCount), RunIndex(InRunIndex)
+	{
+	}
+
+	int32 Count = 0;
+	TFunction<bool(int32)> RunIndex;
+
+	virtual bool ExecuteTask() override;
+};
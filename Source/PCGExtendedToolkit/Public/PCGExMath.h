@@ -156,4 +156,65 @@ namespace PCGExMath
 
 		return Box;
 	}
+
+	/**
+	 * Principal axes of a symmetric 3x3 matrix (typically a covariance), found with cyclic Jacobi rotations.
+	 * @param Covariance Only the upper 3x3 is used
+	 * @return Rotation whose X, Y & Z axes are the principal axes, sorted by decreasing eigenvalue
+	 */
+	static FQuat GetPrincipalAxes(const FMatrix& Covariance)
+	{
+		double A[3][3];
+		double V[3][3] = {{1, 0, 0}, {0, 1, 0}, {0, 0, 1}};
+		for (int i = 0; i < 3; i++) { for (int j = 0; j < 3; j++) { A[i][j] = Covariance.M[i][j]; } }
+
+		for (int Sweep = 0; Sweep < 32; Sweep++)
+		{
+			const double OffDiagonal = FMath::Abs(A[0][1]) + FMath::Abs(A[0][2]) + FMath::Abs(A[1][2]);
+			const double Diagonal = FMath::Abs(A[0][0]) + FMath::Abs(A[1][1]) + FMath::Abs(A[2][2]);
+			if (OffDiagonal <= 1e-15 * Diagonal) { break; }
+
+			for (int p = 0; p < 2; p++)
+			{
+				for (int q = p + 1; q < 3; q++)
+				{
+					const double Apq = A[p][q];
+					if (Apq == 0) { continue; }
+
+					// Rotation in the (p,q) plane that zeroes A[p][q]
+					const double Theta = (A[q][q] - A[p][p]) / (2 * Apq);
+					const double T = (Theta >= 0 ? 1 : -1) / (FMath::Abs(Theta) + FMath::Sqrt(Theta * Theta + 1));
+					const double C = 1 / FMath::Sqrt(T * T + 1);
+					const double S = T * C;
+
+					A[p][p] -= T * Apq;
+					A[q][q] += T * Apq;
+					A[p][q] = A[q][p] = 0;
+
+					const int r = 3 - p - q;
+					const double Arp = A[r][p];
+					const double Arq = A[r][q];
+					A[r][p] = A[p][r] = C * Arp - S * Arq;
+					A[r][q] = A[q][r] = S * Arp + C * Arq;
+
+					for (int k = 0; k < 3; k++)
+					{
+						const double Vkp = V[k][p];
+						const double Vkq = V[k][q];
+						V[k][p] = C * Vkp - S * Vkq;
+						V[k][q] = S * Vkp + C * Vkq;
+					}
+				}
+			}
+		}
+
+		int Order[3] = {0, 1, 2};
+		if (A[Order[0]][Order[0]] < A[Order[1]][Order[1]]) { Swap(Order[0], Order[1]); }
+		if (A[Order[1]][Order[1]] < A[Order[2]][Order[2]]) { Swap(Order[1], Order[2]); }
+		if (A[Order[0]][Order[0]] < A[Order[1]][Order[1]]) { Swap(Order[0], Order[1]); }
+
+		const FVector X = FVector(V[0][Order[0]], V[1][Order[0]], V[2][Order[0]]);
+		const FVector Y = FVector(V[0][Order[1]], V[1][Order[1]], V[2][Order[1]]);
+		return FRotationMatrix::MakeFromXY(X, Y).ToQuat();
+	}
 }
@@ -0,0 +1,94 @@
+﻿// Copyright Timothé Lapetite 2023
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PCGExPathProcessor.h"
+#include "PCGExPointsProcessor.h"
+#include "PCGExSimplify.generated.h"
+
+UENUM(BlueprintType)
+enum class EPCGExSimplifyMethod : uint8
+{
+	VisvalingamWhyatt UMETA(DisplayName = "Visvalingam-Whyatt", ToolTip="Repeatedly remove the point forming the smallest triangle with its neighbors. Preserves the overall shape well."),
+	DouglasPeucker UMETA(DisplayName = "Douglas-Peucker", ToolTip="Recursively keep the point farthest from the current simplified segment. Preserves sharp features well."),
+};
+
+/**
+ * Decimate paths, keeping only the points that matter most to their shape.
+ */
+UCLASS(BlueprintType, ClassGroup = (Procedural), Category="PCGEx|Path")
+class PCGEXTENDEDTOOLKIT_API UPCGExSimplifySettings : public UPCGExPathProcessorSettings
+{
+	GENERATED_BODY()
+
+public:
+	UPCGExSimplifySettings(const FObjectInitializer& ObjectInitializer);
+
+	//~Begin UPCGSettings interface
+#if WITH_EDITOR
+	PCGEX_NODE_INFOS(Simplify, "Path : Simplify", "Remove path points that don't contribute to its shape, using Visvalingam-Whyatt or Douglas-Peucker.");
+#endif
+
+protected:
+	virtual FPCGElementPtr CreateElement() const override;
+	//~End UPCGSettings interface
+
+	//~Begin UPCGExPointsProcessorSettings interface
+public:
+	virtual PCGExData::EInit GetMainOutputInitMode() const override;
+	//~End UPCGExPointsProcessorSettings interface
+
+public:
+	/** Simplification algorithm. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable))
+	EPCGExSimplifyMethod Method = EPCGExSimplifyMethod::VisvalingamWhyatt;
+
+	/** Points whose removal would move the path by less than this distance are removed. For Visvalingam-Whyatt, a point is removed if its triangle area is below Tolerance² */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, ClampMin=0))
+	double Tolerance = 1;
+
+	/** Keep simplifying past the tolerance until paths are down to at most that many points. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, InlineEditConditionToggle))
+	bool bUseTargetPointCount = false;
+
+	/** Maximum number of points kept per path. First and last points are always kept. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, EditCondition="bUseTargetPointCount", ClampMin=2))
+	int32 TargetPointCount = 100;
+};
+
+struct PCGEXTENDEDTOOLKIT_API FPCGExSimplifyContext : public FPCGExPathProcessorContext
+{
+	friend class FPCGExSimplifyElement;
+
+	virtual ~FPCGExSimplifyContext() override;
+
+	EPCGExSimplifyMethod Method;
+	double Tolerance;
+	int32 TargetPointCount;
+};
+
+class PCGEXTENDEDTOOLKIT_API FPCGExSimplifyElement : public FPCGExPathProcessorElement
+{
+public:
+	virtual FPCGContext* Initialize(
+		const FPCGDataCollection& InputData,
+		TWeakObjectPtr<UPCGComponent> SourceComponent,
+		const UPCGNode* Node) override;
+
+protected:
+	virtual bool Boot(FPCGContext* InContext) const override;
+	virtual bool ExecuteInternal(FPCGContext* Context) const override;
+};
+
+class PCGEXTENDEDTOOLKIT_API FPCGExSimplifyTask : public FPCGExNonAbandonableTask
+{
+public:
+	FPCGExSimplifyTask(FPCGExAsyncManager* InManager, const int32 InTaskIndex, PCGExData::FPointIO* InPointIO) :
+		FPCGExNonAbandonableTask(InManager, InTaskIndex, InPointIO)
+	{
+	}
+
+	virtual bool ExecuteTask() override;
+};